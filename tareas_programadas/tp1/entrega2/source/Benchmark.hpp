@@ -0,0 +1,842 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "InputGenerator.hpp"
+#include "MappedFile.hpp"
+#include "OperationCounter.hpp"
+#include "PerfCounters.hpp"
+
+/**
+ * @brief Algoritmo de ordenamiento que puede medir el benchmark.
+ */
+struct SortAlgorithm {
+  /// Nombre usado en la línea de comandos y en los resultados.
+  std::string name;
+  /// Subrutina que ordena un arreglo de enteros.
+  std::function<void(int*, int)> sort;
+  /// Indica si el algoritmo es O(n^2) en el peor caso, por lo que se omite
+  /// con arreglos mayores a Benchmark::quadratic_limit.
+  bool quadratic = false;
+  /// Indica si el algoritmo solo ordena números no negativos.
+  bool non_negative = false;
+  /// La misma subrutina instanciada con la política OperationCount, o vacía
+  /// si el algoritmo no cuenta sus operaciones.
+  std::function<void(int*, int)> counted_sort = nullptr;
+};
+
+/**
+ * @brief Estadísticas de las duraciones de varias repeticiones, en
+ * milisegundos.
+ */
+struct Statistics {
+  /// Menor duración.
+  double min = 0;
+  /// Mediana de las duraciones.
+  double median = 0;
+  /// Percentil 95 de las duraciones (por rango más cercano).
+  double p95 = 0;
+  /// Promedio de las duraciones.
+  double mean = 0;
+  /// Desviación estándar muestral de las duraciones.
+  double stddev = 0;
+
+  /**
+   * @brief Calcula las estadísticas de una lista de duraciones.
+   *
+   * @param samples Duraciones medidas, en milisegundos.
+   * @return Statistics Estadísticas de las duraciones.
+   */
+  static Statistics compute(std::vector<double> samples) {
+    Statistics statistics;
+    if (samples.empty()) { return statistics; }
+    std::sort(samples.begin(), samples.end());
+
+    const std::size_t count = samples.size();
+    statistics.min = samples.front();
+    statistics.median = count % 2 == 1 ? samples[count / 2]
+        : (samples[count / 2 - 1] + samples[count / 2]) / 2;
+    const std::size_t rank = static_cast<std::size_t>(std::ceil(0.95
+        * static_cast<double>(count)));
+    statistics.p95 = samples[std::max<std::size_t>(rank, 1) - 1];
+
+    double sum = 0;
+    for (const double sample : samples) {
+      sum += sample;
+    }
+    statistics.mean = sum / static_cast<double>(count);
+
+    if (count > 1) {
+      double squares = 0;
+      for (const double sample : samples) {
+        squares += (sample - statistics.mean) * (sample - statistics.mean);
+      }
+      statistics.stddev = std::sqrt(squares / static_cast<double>(count - 1));
+    }
+    return statistics;
+  }
+};
+
+/**
+ * @brief Mide algoritmos de ordenamiento con varios tamaños y distribuciones
+ * de entrada, y reporta estadísticas de las duraciones.
+ *
+ * Cada combinación de tamaño, distribución y algoritmo se ejecuta primero
+ * algunas veces sin medir (calentamiento) y luego la cantidad de
+ * repeticiones indicada, siempre sobre una copia del mismo arreglo. El
+ * resultado de cada algoritmo se compara contra std::sort.
+ */
+class Benchmark {
+ public:
+  /// Tamaño máximo con el que se prueban los algoritmos O(n^2).
+  static constexpr std::size_t quadratic_limit = 50000;
+
+  /**
+   * @brief Formatos de salida de los resultados.
+   */
+  enum class Format {
+    /// Tabla alineada para leer en la terminal.
+    kTable,
+    /// Valores separados por comas, una fila por medición.
+    kCsv,
+    /// Objeto JSON con las opciones y una lista de mediciones.
+    kJson
+  };
+
+  /**
+   * @brief Opciones de ejecución del benchmark.
+   */
+  struct Options {
+    /// Nombres de los algoritmos a medir, vacío para medirlos todos.
+    std::vector<std::string> algorithms;
+    /// Tamaños de los arreglos.
+    std::vector<std::size_t> sizes;
+    /// Distribuciones de los arreglos.
+    std::vector<InputGenerator::Distribution> distributions = {
+        InputGenerator::Distribution::kRandom};
+    /// Ejecuciones sin medir antes de las repeticiones.
+    int warmup = 1;
+    /// Ejecuciones medidas de cada combinación.
+    int repetitions = 5;
+    /// Hilos de los algoritmos paralelos, 0 para usar todos los núcleos.
+    int threads = 0;
+    /// Semilla de los generadores de entradas.
+    std::uint64_t seed = 42;
+    /// Formato de salida.
+    Format format = Format::kTable;
+    /// Indica si se leen los contadores de rendimiento del procesador.
+    bool counters = false;
+    /// Indica si se cuentan las operaciones de cada algoritmo.
+    bool operations = false;
+    /// Indica si se ejecutan los reportes adicionales.
+    bool reports = false;
+    /// Archivo binario de enteros a ordenar con el ordenamiento externo,
+    /// vacío para medir los algoritmos en memoria.
+    std::string external_input;
+    /// Archivo donde queda el resultado del ordenamiento externo.
+    std::string external_output;
+    /// Memoria del ordenamiento externo, en MiB.
+    std::size_t memory_mb = 256;
+    /// Directorio de los archivos temporales del ordenamiento externo,
+    /// vacío para usar el del sistema.
+    std::string temp_dir;
+    /// Archivo binario de enteros a ordenar proyectado en memoria, vacío
+    /// para medir los algoritmos en memoria.
+    std::string mapped_input;
+    /// Archivo donde queda el resultado del ordenamiento proyectado, vacío
+    /// para ordenar mapped_input en su lugar.
+    std::string mapped_output;
+    /// Sugerencia de acceso para el archivo proyectado durante el
+    /// ordenamiento.
+    MappedFile::Advice advice = MappedFile::Advice::kNormal;
+    /// Indica si solo se debe imprimir la ayuda.
+    bool help = false;
+  };
+
+  /**
+   * @brief Resultado de medir un algoritmo con un arreglo.
+   */
+  struct Result {
+    /// Nombre del algoritmo.
+    std::string algorithm;
+    /// Nombre de la distribución de entrada.
+    std::string input;
+    /// Tamaño del arreglo.
+    std::size_t size = 0;
+    /// Estadísticas de las duraciones.
+    Statistics statistics;
+    /// Promedio de cada contador de rendimiento por elemento ordenado, NaN
+    /// si el contador no está disponible o no se leyó.
+    PerfCounters::Values counters = Benchmark::missingCounters();
+    /// Operaciones de una ejecución con la política OperationCount.
+    OperationCounts operations;
+    /// Indica si se contaron las operaciones.
+    bool counted = false;
+    /// "ok", "FAILED" si el resultado no coincide con std::sort, o
+    /// "skipped" si el algoritmo no se ejecutó con esta entrada.
+    std::string status;
+  };
+
+ private:
+  /// Opciones de ejecución.
+  Options options;
+  /// Resultados de las mediciones, en el orden en que se hicieron.
+  std::vector<Result> results;
+
+ public:
+  /**
+   * @brief Crea un benchmark con las opciones dadas.
+   *
+   * @param options Opciones de ejecución.
+   */
+  explicit Benchmark(const Options& options) : options(options) {}
+
+  /**
+   * @brief Interpreta los argumentos de la línea de comandos.
+   *
+   * Un argumento numérico suelto se toma como un tamaño de arreglo, para
+   * conservar la forma de uso anterior (programa n).
+   *
+   * @param argc Cantidad de argumentos.
+   * @param argv Argumentos.
+   * @param options Salida: opciones interpretadas.
+   * @return true Si los argumentos son válidos.
+   * @return false Si algún argumento es inválido. El error se imprime en
+   * std::cerr.
+   */
+  static bool parseArguments(int argc, char* argv[], Options& options) {
+    for (int index = 1; index < argc; ++index) {
+      const std::string argument = argv[index];
+      const std::size_t equals = argument.find('=');
+      const std::string name = argument.substr(0, equals);
+      const std::string value = equals == std::string::npos ? ""
+          : argument.substr(equals + 1);
+      bool valid = true;
+
+      if (!argument.empty() && argument[0] != '-') {
+        std::size_t size = 0;
+        valid = Benchmark::parseSize(argument, size);
+        options.sizes.push_back(size);
+      } else if (name == "--help" || name == "-h") {
+        options.help = true;
+      } else if (name == "--counters") {
+        options.counters = true;
+      } else if (name == "--operations") {
+        options.operations = true;
+      } else if (name == "--reports") {
+        options.reports = true;
+      } else if (name == "--external") {
+        const std::vector<std::string> paths = Benchmark::split(value);
+        valid = paths.size() == 2;
+        if (valid) {
+          options.external_input = paths[0];
+          options.external_output = paths[1];
+        }
+      } else if (name == "--mmap") {
+        const std::vector<std::string> paths = Benchmark::split(value);
+        valid = paths.size() == 1 || paths.size() == 2;
+        if (valid) {
+          options.mapped_input = paths[0];
+          options.mapped_output = paths.size() == 2 ? paths[1] : "";
+        }
+      } else if (name == "--advice") {
+        valid = MappedFile::parse(value, options.advice);
+      } else if (name == "--memory") {
+        // Se convierte a bytes con un corrimiento de 20 bits.
+        valid = Benchmark::parseNumber(value, options.memory_mb)
+            && options.memory_mb > 0
+            && options.memory_mb <= std::numeric_limits<std::size_t>::max()
+                >> 20;
+      } else if (name == "--temp-dir") {
+        options.temp_dir = value;
+        valid = !value.empty();
+      } else if (name == "--algorithms") {
+        options.algorithms = Benchmark::split(value);
+        valid = !options.algorithms.empty();
+      } else if (name == "--sizes") {
+        for (const std::string& item : Benchmark::split(value)) {
+          std::size_t size = 0;
+          valid = valid && Benchmark::parseSize(item, size);
+          options.sizes.push_back(size);
+        }
+      } else if (name == "--inputs") {
+        options.distributions.clear();
+        for (const std::string& item : Benchmark::split(value)) {
+          InputGenerator::Distribution distribution
+              = InputGenerator::Distribution::kRandom;
+          valid = valid && InputGenerator::parse(item, distribution);
+          options.distributions.push_back(distribution);
+        }
+        valid = valid && !options.distributions.empty();
+      } else if (name == "--warmup") {
+        valid = Benchmark::parseNumber(value, options.warmup);
+      } else if (name == "--repetitions") {
+        valid = Benchmark::parseNumber(value, options.repetitions)
+            && options.repetitions > 0;
+      } else if (name == "--threads") {
+        valid = Benchmark::parseNumber(value, options.threads);
+      } else if (name == "--seed") {
+        valid = Benchmark::parseNumber(value, options.seed);
+      } else if (name == "--format") {
+        if (value == "table") {
+          options.format = Format::kTable;
+        } else if (value == "csv") {
+          options.format = Format::kCsv;
+        } else if (value == "json") {
+          options.format = Format::kJson;
+        } else {
+          valid = false;
+        }
+      } else {
+        std::cerr << "Error: Unknown option " << argument << std::endl;
+        return false;
+      }
+
+      if (!valid) {
+        std::cerr << "Error: Invalid value in " << argument << std::endl;
+        return false;
+      }
+    }
+
+    if (!options.help && options.sizes.empty()
+        && options.external_input.empty() && options.mapped_input.empty()) {
+      std::cerr << "Error: No Array Length Provided as Command Line Argument"
+                << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Imprime la forma de uso del programa.
+   *
+   * @param out Flujo de salida.
+   * @param program Nombre del programa.
+   * @param algorithms Algoritmos disponibles.
+   */
+  static void printUsage(std::ostream& out, const std::string& program,
+      const std::vector<SortAlgorithm>& algorithms) {
+    out << "Usage: " << program << " [n...] [options]" << std::endl
+        << "  --sizes=n,...          array lengths" << std::endl
+        << "  --algorithms=a,...     algorithms to run (default: all)"
+        << std::endl
+        << "  --inputs=d,...         input distributions (default: random)"
+        << std::endl
+        << "  --warmup=k             unmeasured runs (default: 1)" << std::endl
+        << "  --repetitions=k        measured runs (default: 5)" << std::endl
+        << "  --threads=k            threads for parallel algorithms"
+        << " (default: all cores)" << std::endl
+        << "  --seed=s               input generator seed (default: 42)"
+        << std::endl
+        << "  --format=table|csv|json" << std::endl
+        << "  --counters             read hardware performance counters"
+        << std::endl
+        << "  --operations           count comparisons, swaps, moves and"
+        << " allocations" << std::endl
+        << "  --reports              also run the crossover and speedup"
+        << " reports" << std::endl
+        << "  --external=in,out      sort a binary file of int32 keys that"
+        << " may not fit in memory" << std::endl
+        << "  --memory=MiB           external sort memory budget"
+        << " (default: 256)" << std::endl
+        << "  --temp-dir=dir         external sort temporary files"
+        << " (default: system temp)" << std::endl
+        << "  --mmap=in[,out]        sort a memory-mapped binary file of"
+        << " int32 keys in place or into out" << std::endl
+        << "  --advice=a             madvise hint while sorting a mapped"
+        << " file (default: normal)" << std::endl
+        << "Algorithms:";
+    for (const SortAlgorithm& algorithm : algorithms) {
+      out << " " << algorithm.name;
+    }
+    out << std::endl << "Inputs:";
+    for (const auto& distribution : InputGenerator::all()) {
+      out << " " << distribution.second;
+    }
+    out << std::endl << "Advice:";
+    for (const auto& advice : MappedFile::all()) {
+      out << " " << advice.second;
+    }
+    out << std::endl;
+  }
+
+  /**
+   * @brief Mide un ordenamiento varias veces sobre copias del mismo arreglo.
+   *
+   * @param input Arreglo desordenado original.
+   * @param output Arreglo donde queda el resultado de la última ejecución.
+   * Debe tener el mismo tamaño que input.
+   * @param sort Subrutina que ordena un arreglo.
+   * @param warmup Ejecuciones sin medir.
+   * @param repetitions Ejecuciones medidas.
+   * @param counters Contadores de rendimiento que acumulan los eventos de
+   * las ejecuciones medidas, o nullptr para no contarlos.
+   * @return Statistics Estadísticas de las ejecuciones medidas.
+   */
+  template <typename Sort>
+  static Statistics measure(const std::vector<int>& input,
+      std::vector<int>& output, const Sort& sort, const int warmup,
+      const int repetitions, PerfCounters* counters = nullptr) {
+    const int length = static_cast<int>(input.size());
+    for (int run = 0; run < warmup; ++run) {
+      std::copy(input.begin(), input.end(), output.begin());
+      sort(output.data(), length);
+    }
+
+    std::vector<double> samples;
+    samples.reserve(repetitions);
+    if (counters != nullptr) { counters->reset(); }
+    for (int run = 0; run < repetitions; ++run) {
+      std::copy(input.begin(), input.end(), output.begin());
+      // Los contadores se detienen durante la copia y fuera del cronómetro.
+      if (counters != nullptr) { counters->start(); }
+      auto startTime = std::chrono::high_resolution_clock::now();
+      sort(output.data(), length);
+      auto endTime = std::chrono::high_resolution_clock::now();
+      if (counters != nullptr) { counters->stop(); }
+      std::chrono::duration<double, std::milli> duration = endTime - startTime;
+      samples.push_back(duration.count());
+    }
+    return Statistics::compute(std::move(samples));
+  }
+
+  /**
+   * @brief Mide los algoritmos seleccionados con cada tamaño y distribución.
+   *
+   * @param algorithms Algoritmos disponibles.
+   * @return true Si se pudieron ejecutar las mediciones.
+   * @return false Si algún algoritmo solicitado no existe. El error se
+   * imprime en std::cerr.
+   */
+  bool run(const std::vector<SortAlgorithm>& algorithms) {
+    std::vector<const SortAlgorithm*> selected;
+    if (!this->select(algorithms, selected)) { return false; }
+
+    std::unique_ptr<PerfCounters> counters;
+    if (this->options.counters) {
+      counters = std::make_unique<PerfCounters>();
+      if (!counters->available()) {
+        std::cerr << "Warning: Performance counters unavailable, check "
+                  << "/proc/sys/kernel/perf_event_paranoid" << std::endl;
+        counters.reset();
+      }
+    }
+
+    for (const std::size_t size : this->options.sizes) {
+      for (const InputGenerator::Distribution distribution
+          : this->options.distributions) {
+        const std::vector<int> input = InputGenerator::generate(distribution,
+            size, this->options.seed);
+        std::vector<int> expected(input);
+        std::sort(expected.begin(), expected.end());
+        std::vector<int> output(size);
+
+        for (const SortAlgorithm* algorithm : selected) {
+          Result result;
+          result.algorithm = algorithm->name;
+          result.input = InputGenerator::name(distribution);
+          result.size = size;
+          if ((algorithm->quadratic && size > Benchmark::quadratic_limit)
+              || (algorithm->non_negative && !expected.empty()
+              && expected.front() < 0)) {
+            result.status = "skipped";
+          } else {
+            result.statistics = Benchmark::measure(input, output,
+                algorithm->sort, this->options.warmup,
+                this->options.repetitions, counters.get());
+            result.status = output == expected ? "ok" : "FAILED";
+            if (counters != nullptr && size > 0) {
+              result.counters = counters->read();
+              for (double& value : result.counters) {
+                value /= static_cast<double>(size)
+                    * this->options.repetitions;
+              }
+            }
+            if (this->options.operations && algorithm->counted_sort) {
+              // Ejecución aparte, sin medir, para no alterar los tiempos.
+              std::copy(input.begin(), input.end(), output.begin());
+              OperationCount::reset();
+              algorithm->counted_sort(output.data(), static_cast<int>(size));
+              result.operations = OperationCount::read();
+              result.counted = true;
+              if (output != expected) { result.status = "FAILED"; }
+            }
+          }
+          this->results.push_back(result);
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Retorna los resultados de las mediciones.
+   *
+   * @return const std::vector<Result>& Resultados.
+   */
+  const std::vector<Result>& getResults() const { return this->results; }
+
+  /**
+   * @brief Imprime los resultados en el formato de las opciones.
+   *
+   * @param out Flujo de salida.
+   */
+  void print(std::ostream& out) const {
+    switch (this->options.format) {
+      case Format::kTable: this->printTable(out); break;
+      case Format::kCsv: this->printCsv(out); break;
+      case Format::kJson: this->printJson(out); break;
+    }
+  }
+
+ private:
+  /**
+   * @brief Interpreta un número entero no negativo.
+   *
+   * @param text Texto a interpretar.
+   * @param number Salida: número interpretado.
+   * @return true Si todo el texto es un número válido que cabe en Number.
+   */
+  template <typename Number>
+  static bool parseNumber(const std::string& text, Number& number) {
+    // strtoull acepta espacios y signos al inicio: exigir un dígito.
+    if (text.empty() || text[0] < '0' || text[0] > '9') { return false; }
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long value = std::strtoull(text.c_str(), &end, 10);
+    if (*end != '\0' || errno == ERANGE || value > static_cast<
+        unsigned long long>(std::numeric_limits<Number>::max())) {
+      return false;
+    }
+    number = static_cast<Number>(value);
+    return true;
+  }
+
+  /**
+   * @brief Interpreta el tamaño de un arreglo, entre 1 e INT_MAX, ya que los
+   * algoritmos reciben el tamaño como int.
+   *
+   * @param text Texto a interpretar.
+   * @param size Salida: tamaño interpretado.
+   * @return true Si el texto es un tamaño válido.
+   */
+  static bool parseSize(const std::string& text, std::size_t& size) {
+    return Benchmark::parseNumber(text, size) && size > 0
+        && size <= static_cast<std::size_t>(std::numeric_limits<int>::max());
+  }
+
+  /**
+   * @brief Separa una lista de valores separados por comas.
+   *
+   * @param text Lista a separar.
+   * @return std::vector<std::string> Valores no vacíos de la lista.
+   */
+  static std::vector<std::string> split(const std::string& text) {
+    std::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+      if (!item.empty()) { items.push_back(item); }
+    }
+    return items;
+  }
+
+  /**
+   * @brief Retorna valores de contadores que no se leyeron.
+   *
+   * @return PerfCounters::Values Todos los valores en NaN.
+   */
+  static PerfCounters::Values missingCounters() {
+    PerfCounters::Values values;
+    values.fill(std::numeric_limits<double>::quiet_NaN());
+    return values;
+  }
+
+  /**
+   * @brief Busca los algoritmos solicitados en las opciones.
+   *
+   * @param algorithms Algoritmos disponibles.
+   * @param selected Salida: algoritmos a medir, en el orden solicitado.
+   * @return true Si todos los algoritmos solicitados existen.
+   */
+  bool select(const std::vector<SortAlgorithm>& algorithms,
+      std::vector<const SortAlgorithm*>& selected) const {
+    if (this->options.algorithms.empty()) {
+      for (const SortAlgorithm& algorithm : algorithms) {
+        selected.push_back(&algorithm);
+      }
+      return true;
+    }
+
+    for (const std::string& name : this->options.algorithms) {
+      auto found = std::find_if(algorithms.begin(), algorithms.end(),
+          [&](const SortAlgorithm& algorithm) {
+            return algorithm.name == name;
+          });
+      if (found == algorithms.end()) {
+        std::cerr << "Error: Unknown algorithm " << name << std::endl;
+        return false;
+      }
+      selected.push_back(&*found);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Imprime los resultados como una tabla alineada, con una tabla
+   * por cada tamaño y distribución de entrada.
+   *
+   * @param out Flujo de salida.
+   */
+  void printTable(std::ostream& out) const {
+    out << std::endl << "Warmup: " << this->options.warmup
+        << "\tRepetitions: " << this->options.repetitions
+        << "\tSeed: " << this->options.seed << std::endl;
+
+    const std::size_t previous = out.precision();
+    out << std::fixed << std::setprecision(3);
+    std::size_t first = 0;
+    while (first < this->results.size()) {
+      // Resultados consecutivos con el mismo tamaño y entrada.
+      std::size_t last = first + 1;
+      while (last < this->results.size()
+          && this->results[last].size == this->results[first].size
+          && this->results[last].input == this->results[first].input) {
+        ++last;
+      }
+
+      out << std::endl << "Array Length: " << this->results[first].size
+          << "\tInput: " << this->results[first].input << std::endl
+          << std::left << std::setw(20) << "algorithm" << std::right
+          << std::setw(12) << "median ms" << std::setw(12) << "p95 ms"
+          << std::setw(12) << "stddev ms" << std::setw(12) << "min ms"
+          << "  check" << std::endl;
+      for (std::size_t index = first; index < last; ++index) {
+        const Result& result = this->results[index];
+        out << std::left << std::setw(20) << result.algorithm << std::right;
+        if (result.status == "skipped") {
+          out << std::setw(48) << "-" << "  skipped" << std::endl;
+          continue;
+        }
+        out << std::setw(12) << result.statistics.median
+            << std::setw(12) << result.statistics.p95
+            << std::setw(12) << result.statistics.stddev
+            << std::setw(12) << result.statistics.min
+            << "  " << result.status << std::endl;
+      }
+      if (this->options.counters) {
+        this->printCounterTable(out, first, last);
+      }
+      if (this->options.operations) {
+        this->printOperationTable(out, first, last);
+      }
+      first = last;
+    }
+    out.unsetf(std::ios::floatfield);
+    out.precision(previous);
+  }
+
+  /**
+   * @brief Imprime los contadores de rendimiento por elemento de un rango de
+   * resultados, junto con las instrucciones por ciclo (IPC).
+   *
+   * @param out Flujo de salida.
+   * @param first Índice del primer resultado.
+   * @param last Índice siguiente al último resultado.
+   */
+  void printCounterTable(std::ostream& out, const std::size_t first,
+      const std::size_t last) const {
+    out << std::left << std::setw(20) << "per element" << std::right
+        << std::setw(10) << "cycles" << std::setw(10) << "instr"
+        << std::setw(8) << "IPC" << std::setw(10) << "br-miss"
+        << std::setw(10) << "L1d-miss" << std::setw(10) << "LLC-miss"
+        << std::setw(10) << "pg-fault" << std::endl;
+    for (std::size_t index = first; index < last; ++index) {
+      const Result& result = this->results[index];
+      if (result.status == "skipped") { continue; }
+      const PerfCounters::Values& counters = result.counters;
+      out << std::left << std::setw(20) << result.algorithm << std::right;
+      Benchmark::printCounter(out, counters[PerfCounters::kCycles], 10);
+      Benchmark::printCounter(out, counters[PerfCounters::kInstructions], 10);
+      Benchmark::printCounter(out, counters[PerfCounters::kInstructions]
+          / counters[PerfCounters::kCycles], 8);
+      Benchmark::printCounter(out, counters[PerfCounters::kBranchMisses], 10);
+      Benchmark::printCounter(out, counters[PerfCounters::kL1Misses], 10);
+      Benchmark::printCounter(out, counters[PerfCounters::kLlcMisses], 10);
+      Benchmark::printCounter(out, counters[PerfCounters::kPageFaults], 10);
+      out << std::endl;
+    }
+  }
+
+  /**
+   * @brief Imprime las operaciones contadas de un rango de resultados, junto
+   * con las comparaciones divididas entre n log2(n), que se acercan a una
+   * constante en los algoritmos O(n log n).
+   *
+   * @param out Flujo de salida.
+   * @param first Índice del primer resultado.
+   * @param last Índice siguiente al último resultado.
+   */
+  void printOperationTable(std::ostream& out, const std::size_t first,
+      const std::size_t last) const {
+    out << std::left << std::setw(20) << "operations" << std::right
+        << std::setw(14) << "comparisons" << std::setw(14) << "swaps"
+        << std::setw(14) << "moves" << std::setw(8) << "allocs"
+        << std::setw(14) << "alloc bytes" << std::setw(12) << "cmp/nlog2n"
+        << std::endl;
+    for (std::size_t index = first; index < last; ++index) {
+      const Result& result = this->results[index];
+      if (!result.counted) { continue; }
+      const OperationCounts& operations = result.operations;
+      const double size = static_cast<double>(result.size);
+      const double n_log_n = size * std::log2(size);
+      out << std::left << std::setw(20) << result.algorithm << std::right
+          << std::setw(14) << operations.comparisons
+          << std::setw(14) << operations.swaps
+          << std::setw(14) << operations.moves
+          << std::setw(8) << operations.allocations
+          << std::setw(14) << operations.allocated_bytes;
+      Benchmark::printCounter(out, n_log_n > 0
+          ? static_cast<double>(operations.comparisons) / n_log_n
+          : std::numeric_limits<double>::quiet_NaN(), 12);
+      out << std::endl;
+    }
+  }
+
+  /**
+   * @brief Imprime el valor de un contador en una columna de la tabla, o
+   * "n/a" si no está disponible.
+   *
+   * @param out Flujo de salida.
+   * @param value Valor del contador.
+   * @param width Ancho de la columna.
+   */
+  static void printCounter(std::ostream& out, const double value,
+      const int width) {
+    out << std::setw(width);
+    if (std::isnan(value)) {
+      out << "n/a";
+    } else {
+      out << value;
+    }
+  }
+
+  /**
+   * @brief Imprime los resultados como valores separados por comas. Los
+   * contadores de rendimiento no disponibles y las operaciones no contadas
+   * quedan vacíos.
+   *
+   * @param out Flujo de salida.
+   */
+  void printCsv(std::ostream& out) const {
+    out << "algorithm,input,size,warmup,repetitions,min_ms,median_ms,p95_ms,"
+        << "mean_ms,stddev_ms,status";
+    if (this->options.counters) {
+      for (int event = 0; event < PerfCounters::kEventCount; ++event) {
+        out << "," << PerfCounters::name(static_cast<PerfCounters::Event>(
+            event)) << "_per_element";
+      }
+    }
+    if (this->options.operations) {
+      out << ",comparisons,swaps,moves,allocations,allocated_bytes";
+    }
+    out << std::endl;
+
+    for (const Result& result : this->results) {
+      out << result.algorithm << "," << result.input << "," << result.size
+          << "," << this->options.warmup << "," << this->options.repetitions
+          << "," << result.statistics.min << "," << result.statistics.median
+          << "," << result.statistics.p95 << "," << result.statistics.mean
+          << "," << result.statistics.stddev << "," << result.status;
+      if (this->options.counters) {
+        for (const double value : result.counters) {
+          out << ",";
+          if (!std::isnan(value)) { out << value; }
+        }
+      }
+      if (this->options.operations && result.counted) {
+        const OperationCounts& operations = result.operations;
+        out << "," << operations.comparisons << "," << operations.swaps << ","
+            << operations.moves << "," << operations.allocations << ","
+            << operations.allocated_bytes;
+      } else if (this->options.operations) {
+        out << ",,,,,";
+      }
+      out << std::endl;
+    }
+  }
+
+  /**
+   * @brief Imprime las opciones y los resultados como un objeto JSON. Los
+   * contadores de rendimiento no disponibles y las operaciones no contadas
+   * quedan en null.
+   *
+   * @param out Flujo de salida.
+   */
+  void printJson(std::ostream& out) const {
+    out << "{" << std::endl
+        << "  \"warmup\": " << this->options.warmup << "," << std::endl
+        << "  \"repetitions\": " << this->options.repetitions << ","
+        << std::endl
+        << "  \"seed\": " << this->options.seed << "," << std::endl
+        << "  \"results\": [";
+    for (std::size_t index = 0; index < this->results.size(); ++index) {
+      const Result& result = this->results[index];
+      out << (index == 0 ? "" : ",") << std::endl
+          << "    {\"algorithm\": \"" << result.algorithm
+          << "\", \"input\": \"" << result.input
+          << "\", \"size\": " << result.size
+          << ", \"min_ms\": " << result.statistics.min
+          << ", \"median_ms\": " << result.statistics.median
+          << ", \"p95_ms\": " << result.statistics.p95
+          << ", \"mean_ms\": " << result.statistics.mean
+          << ", \"stddev_ms\": " << result.statistics.stddev
+          << ", \"status\": \"" << result.status << "\"";
+      if (this->options.counters) {
+        out << ", \"per_element\": {";
+        for (int event = 0; event < PerfCounters::kEventCount; ++event) {
+          const double value = result.counters[event];
+          out << (event == 0 ? "" : ", ") << "\"" << PerfCounters::name(
+              static_cast<PerfCounters::Event>(event)) << "\": ";
+          if (std::isnan(value)) {
+            out << "null";
+          } else {
+            out << value;
+          }
+        }
+        out << "}";
+      }
+      if (this->options.operations) {
+        out << ", \"operations\": ";
+        if (result.counted) {
+          const OperationCounts& operations = result.operations;
+          out << "{\"comparisons\": " << operations.comparisons
+              << ", \"swaps\": " << operations.swaps
+              << ", \"moves\": " << operations.moves
+              << ", \"allocations\": " << operations.allocations
+              << ", \"allocated_bytes\": " << operations.allocated_bytes
+              << "}";
+        } else {
+          out << "null";
+        }
+      }
+      out << "}";
+    }
+    out << std::endl << "  ]" << std::endl << "}" << std::endl;
+  }
+};
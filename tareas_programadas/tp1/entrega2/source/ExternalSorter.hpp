@@ -0,0 +1,674 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "Ordenador.hpp"
+
+/**
+ * @brief Ordena archivos binarios de enteros de 32 bits más grandes que la
+ * memoria con un Merge Sort externo.
+ *
+ * Primero lee el archivo en bloques que caben en la memoria disponible,
+ * ordena cada bloque con el Merge Sort paralelo de Ordenador y lo escribe en
+ * un archivo temporal (una corrida). Luego mezcla las corridas con un árbol
+ * de perdedores, leyendo y escribiendo en bloques grandes y secuenciales. Si
+ * hay más corridas de las que se pueden mezclar a la vez con la memoria
+ * disponible, hace varias pasadas de mezcla.
+ *
+ * Los archivos tienen los enteros en el orden de bytes de la máquina, sin
+ * encabezado. Los errores se imprimen en std::cerr y sort() retorna false.
+ */
+class ExternalSorter {
+ public:
+  /// Tipo de los elementos de los archivos.
+  using Element = std::int32_t;
+
+  /// Memoria mínima que se puede asignar al ordenamiento, en bytes.
+  static constexpr std::size_t min_memory = 1 << 20;
+  /// Tamaño mínimo del buffer de cada corrida durante la mezcla, en bytes,
+  /// para que las lecturas sigan siendo secuenciales.
+  static constexpr std::size_t min_buffer = 64 << 10;
+  /// Cantidad máxima de corridas que se mezclan a la vez, para no agotar
+  /// los descriptores de archivo.
+  static constexpr std::size_t max_fan_in = 256;
+
+  /**
+   * @brief Resumen de la última ejecución de sort().
+   */
+  struct Report {
+    /// Cantidad de elementos ordenados.
+    std::size_t elements = 0;
+    /// Cantidad de corridas iniciales.
+    std::size_t runs = 0;
+    /// Cantidad de pasadas de mezcla, incluyendo la final. Es 0 si todo el
+    /// archivo cupo en una corrida.
+    std::size_t merge_passes = 0;
+    /// Corridas que se mezclan a la vez como máximo.
+    std::size_t fan_in = 0;
+    /// Duración de la generación de corridas, en milisegundos.
+    double run_ms = 0;
+    /// Duración de las mezclas, en milisegundos.
+    double merge_ms = 0;
+  };
+
+ private:
+  /**
+   * @brief Lee un archivo de enteros de forma secuencial a través de un
+   * buffer.
+   */
+  class RunReader {
+   private:
+    /// Archivo abierto.
+    std::FILE* file = nullptr;
+    /// Elementos leídos del archivo y no consumidos aún.
+    std::vector<Element> buffer;
+    /// Posición del siguiente elemento en el buffer.
+    std::size_t position = 0;
+    /// Cantidad de elementos válidos en el buffer.
+    std::size_t length = 0;
+    /// Indica si hubo un error de lectura.
+    bool failed = false;
+
+   public:
+    /**
+     * @brief Abre un archivo para leerlo.
+     *
+     * @param path Ruta del archivo.
+     * @param buffer_len Cantidad de elementos del buffer.
+     */
+    RunReader(const std::string& path, const std::size_t buffer_len)
+        : file(std::fopen(path.c_str(), "rb")),
+          buffer(std::max<std::size_t>(buffer_len, 1)) {
+      this->failed = this->file == nullptr;
+    }
+
+    /**
+     * @brief Cierra el archivo.
+     */
+    ~RunReader() {
+      if (this->file != nullptr) { std::fclose(this->file); }
+    }
+
+    RunReader(const RunReader& other) = delete;
+    RunReader(RunReader&& other) = delete;
+    RunReader& operator=(const RunReader& other) = delete;
+    RunReader& operator=(RunReader&& other) = delete;
+
+    /**
+     * @brief Lee el siguiente elemento.
+     *
+     * @param value Salida: elemento leído.
+     * @return true Si se leyó un elemento.
+     * @return false Si el archivo terminó o hubo un error, ver error().
+     */
+    bool next(Element& value) {
+      if (this->position == this->length) {
+        if (this->failed) { return false; }
+        this->length = std::fread(this->buffer.data(), sizeof(Element),
+            this->buffer.size(), this->file);
+        this->position = 0;
+        if (this->length < this->buffer.size()
+            && std::ferror(this->file) != 0) {
+          this->failed = true;
+        }
+        if (this->length == 0) { return false; }
+      }
+      value = this->buffer[this->position++];
+      return true;
+    }
+
+    /**
+     * @brief Indica si hubo un error al abrir o leer el archivo.
+     *
+     * @return true Si hubo un error.
+     */
+    bool error() const { return this->failed; }
+  };
+
+  /**
+   * @brief Escribe enteros en un archivo de forma secuencial a través de
+   * un buffer.
+   */
+  class RunWriter {
+   private:
+    /// Archivo abierto.
+    std::FILE* file = nullptr;
+    /// Elementos pendientes de escribir.
+    std::vector<Element> buffer;
+    /// Cantidad de elementos pendientes en el buffer.
+    std::size_t length = 0;
+    /// Indica si hubo un error de escritura.
+    bool failed = false;
+
+   public:
+    /**
+     * @brief Crea o trunca un archivo para escribirlo.
+     *
+     * @param path Ruta del archivo.
+     * @param buffer_len Cantidad de elementos del buffer.
+     */
+    RunWriter(const std::string& path, const std::size_t buffer_len)
+        : file(std::fopen(path.c_str(), "wb")),
+          buffer(std::max<std::size_t>(buffer_len, 1)) {
+      this->failed = this->file == nullptr;
+    }
+
+    /**
+     * @brief Escribe lo pendiente y cierra el archivo.
+     */
+    ~RunWriter() { this->close(); }
+
+    RunWriter(const RunWriter& other) = delete;
+    RunWriter(RunWriter&& other) = delete;
+    RunWriter& operator=(const RunWriter& other) = delete;
+    RunWriter& operator=(RunWriter&& other) = delete;
+
+    /**
+     * @brief Agrega un elemento al archivo.
+     *
+     * @param value Elemento a escribir.
+     */
+    inline void put(const Element value) {
+      this->buffer[this->length++] = value;
+      if (this->length == this->buffer.size()) { this->flush(); }
+    }
+
+    /**
+     * @brief Escribe un bloque de elementos directamente, sin copiarlo al
+     * buffer.
+     *
+     * @param values Elementos a escribir.
+     * @param count Cantidad de elementos.
+     */
+    void write(const Element* values, const std::size_t count) {
+      this->flush();
+      if (!this->failed && std::fwrite(values, sizeof(Element), count,
+          this->file) != count) {
+        this->failed = true;
+      }
+    }
+
+    /**
+     * @brief Escribe lo pendiente y cierra el archivo.
+     *
+     * @return true Si todas las escrituras fueron exitosas.
+     */
+    bool close() {
+      if (this->file != nullptr) {
+        this->flush();
+        if (std::fclose(this->file) != 0) { this->failed = true; }
+        this->file = nullptr;
+      }
+      return !this->failed;
+    }
+
+   private:
+    /**
+     * @brief Escribe los elementos pendientes del buffer.
+     */
+    void flush() {
+      if (!this->failed && this->length > 0 && std::fwrite(
+          this->buffer.data(), sizeof(Element), this->length, this->file)
+          != this->length) {
+        this->failed = true;
+      }
+      this->length = 0;
+    }
+  };
+
+  /**
+   * @brief Árbol de perdedores para mezclar k secuencias ordenadas.
+   *
+   * Cada nodo interno guarda la hoja que perdió la comparación en ese nodo,
+   * y la raíz guarda la ganadora. Al reemplazar el elemento de la ganadora
+   * solo se recorre el camino de esa hoja a la raíz, con una comparación
+   * por nivel: log2(k) comparaciones por elemento, sin comparar contra los
+   * hermanos como en un montículo. Las secuencias terminadas pierden
+   * siempre.
+   */
+  class LoserTree {
+   private:
+    /// Cantidad de hojas.
+    std::size_t leaves;
+    /// tree[0] es la hoja ganadora y tree[1:k-1] las perdedoras de cada
+    /// nodo interno. El padre de la hoja i es (i + k) / 2.
+    std::vector<std::size_t> tree;
+    /// Elemento actual de cada hoja.
+    std::vector<Element> keys;
+    /// Indica si la secuencia de cada hoja todavía tiene elementos.
+    std::vector<bool> active;
+
+   public:
+    /**
+     * @brief Crea un árbol con k hojas, todas terminadas.
+     *
+     * @param leaves Cantidad de hojas, al menos 1.
+     */
+    explicit LoserTree(const std::size_t leaves)
+        : leaves(leaves), tree(leaves, 0), keys(leaves, 0),
+          active(leaves, false) {}
+
+    /**
+     * @brief Asigna el primer elemento de una hoja, antes de build().
+     *
+     * @param leaf Hoja.
+     * @param key Elemento.
+     */
+    void set(const std::size_t leaf, const Element key) {
+      this->keys[leaf] = key;
+      this->active[leaf] = true;
+    }
+
+    /**
+     * @brief Juega el torneo completo a partir de las hojas.
+     */
+    void build() {
+      // Ganadora de cada nodo; las hojas están en [k, 2k).
+      std::vector<std::size_t> winners(2 * this->leaves);
+      for (std::size_t leaf = 0; leaf < this->leaves; ++leaf) {
+        winners[this->leaves + leaf] = leaf;
+      }
+      for (std::size_t node = this->leaves - 1; node > 0; --node) {
+        const std::size_t left = winners[2 * node];
+        const std::size_t right = winners[2 * node + 1];
+        const bool left_wins = this->beats(left, right);
+        winners[node] = left_wins ? left : right;
+        this->tree[node] = left_wins ? right : left;
+      }
+      this->tree[0] = winners[1];
+    }
+
+    /**
+     * @brief Indica si todavía quedan elementos en alguna hoja.
+     *
+     * @return true Si la ganadora no ha terminado.
+     */
+    bool empty() const { return !this->active[this->tree[0]]; }
+
+    /**
+     * @brief Retorna la hoja con el menor elemento.
+     *
+     * @return std::size_t Hoja ganadora.
+     */
+    std::size_t winner() const { return this->tree[0]; }
+
+    /**
+     * @brief Retorna el menor elemento.
+     *
+     * @return Element Elemento de la hoja ganadora.
+     */
+    Element top() const { return this->keys[this->tree[0]]; }
+
+    /**
+     * @brief Reemplaza el elemento de la hoja ganadora y repite los
+     * partidos de su camino a la raíz.
+     *
+     * @param key Nuevo elemento.
+     * @param available false si la secuencia de la hoja terminó.
+     */
+    void replaceTop(const Element key, const bool available) {
+      std::size_t winner = this->tree[0];
+      this->keys[winner] = key;
+      this->active[winner] = available;
+      for (std::size_t node = (winner + this->leaves) / 2; node > 0;
+          node /= 2) {
+        if (this->beats(this->tree[node], winner)) {
+          std::swap(this->tree[node], winner);
+        }
+      }
+      this->tree[0] = winner;
+    }
+
+   private:
+    /**
+     * @brief Indica si la hoja a le gana a la hoja b. Ante empates gana la
+     * de menor índice, por lo que la mezcla es estable.
+     *
+     * @param a Primera hoja.
+     * @param b Segunda hoja.
+     * @return true Si el elemento de a va antes que el de b.
+     */
+    inline bool beats(const std::size_t a, const std::size_t b) const {
+      if (!this->active[a]) { return false; }
+      if (!this->active[b]) { return true; }
+      return this->keys[a] < this->keys[b]
+          || (this->keys[a] == this->keys[b] && a < b);
+    }
+  };
+
+  /// Memoria disponible para el ordenamiento, en bytes.
+  std::size_t memory;
+  /// Hilos del ordenamiento de cada bloque, 0 para usar todos los núcleos.
+  int threads;
+  /// Directorio donde se crean los archivos temporales.
+  std::string temp_dir;
+  /// Directorio propio de los archivos temporales de la ejecución actual.
+  std::filesystem::path work_dir;
+  /// Cantidad de archivos temporales creados en la ejecución actual.
+  std::size_t temp_count = 0;
+  /// Resumen de la última ejecución.
+  Report report;
+
+ public:
+  /**
+   * @brief Crea un ordenador externo.
+   *
+   * @param memory Memoria disponible en bytes, al menos min_memory.
+   * @param threads Hilos del ordenamiento de cada bloque, 0 para usar todos
+   * los núcleos.
+   * @param temp_dir Directorio de los archivos temporales, vacío para usar
+   * el directorio temporal del sistema.
+   */
+  explicit ExternalSorter(const std::size_t memory, const int threads = 0,
+      std::string temp_dir = "")
+      : memory(std::max(memory, ExternalSorter::min_memory)),
+        threads(threads), temp_dir(std::move(temp_dir)) {}
+
+  ExternalSorter(const ExternalSorter& other) = delete;
+  ExternalSorter(ExternalSorter&& other) = delete;
+  ExternalSorter& operator=(const ExternalSorter& other) = delete;
+  ExternalSorter& operator=(ExternalSorter&& other) = delete;
+
+  /**
+   * @brief Ordena un archivo de enteros de 32 bits.
+   *
+   * @param input Ruta del archivo a ordenar.
+   * @param output Ruta del archivo ordenado, se crea o se reemplaza. Puede
+   * ser igual a input.
+   * @return true Si el archivo se ordenó.
+   * @return false Si hubo un error. El error se imprime en std::cerr.
+   */
+  bool sort(const std::string& input, const std::string& output) {
+    this->report = Report();
+    if (this->threads < 0) {
+      std::cerr << "La cantidad de hilos no es válida." << std::endl;
+      return false;
+    }
+    if (!this->createWorkDir()) { return false; }
+
+    std::vector<std::string> runs;
+    auto start = std::chrono::high_resolution_clock::now();
+    bool success = this->createRuns(input, runs);
+    auto end = std::chrono::high_resolution_clock::now();
+    this->report.run_ms = std::chrono::duration<double, std::milli>(
+        end - start).count();
+    this->report.runs = runs.size();
+
+    start = std::chrono::high_resolution_clock::now();
+    success = success && this->mergeRuns(runs, output);
+    end = std::chrono::high_resolution_clock::now();
+    this->report.merge_ms = std::chrono::duration<double, std::milli>(
+        end - start).count();
+
+    std::error_code error;
+    std::filesystem::remove_all(this->work_dir, error);
+    return success;
+  }
+
+  /**
+   * @brief Retorna el resumen de la última ejecución de sort().
+   *
+   * @return const Report& Resumen.
+   */
+  const Report& getReport() const { return this->report; }
+
+  /**
+   * @brief Revisa si un archivo de enteros está ordenado, leyéndolo de
+   * forma secuencial.
+   *
+   * @param path Ruta del archivo.
+   * @param count Salida: cantidad de elementos del archivo.
+   * @return true Si el archivo se pudo leer y está ordenado.
+   */
+  static bool isSorted(const std::string& path, std::size_t& count) {
+    RunReader reader(path, ExternalSorter::min_buffer / sizeof(Element));
+    count = 0;
+    Element previous = 0;
+    Element value = 0;
+    bool sorted = true;
+    while (reader.next(value)) {
+      sorted = sorted && (count == 0 || previous <= value);
+      previous = value;
+      ++count;
+    }
+    return sorted && !reader.error();
+  }
+
+ private:
+  /**
+   * @brief Crea un directorio propio para los archivos temporales, con un
+   * nombre aleatorio para no chocar con otras ejecuciones.
+   *
+   * @return true Si se creó el directorio.
+   */
+  bool createWorkDir() {
+    std::error_code error;
+    const std::filesystem::path parent = this->temp_dir.empty()
+        ? std::filesystem::temp_directory_path(error)
+        : std::filesystem::path(this->temp_dir);
+    if (!error) {
+      std::random_device random;
+      std::ostringstream name;
+      name << "external-sort-" << std::hex << random() << random();
+      this->work_dir = parent / name.str();
+      this->temp_count = 0;
+      if (std::filesystem::create_directory(this->work_dir, error)) {
+        return true;
+      }
+    }
+    std::cerr << "No se pudo crear el directorio temporal en " << parent
+              << ": " << error.message() << std::endl;
+    return false;
+  }
+
+  /**
+   * @brief Retorna la ruta de un archivo temporal nuevo.
+   *
+   * @return std::string Ruta del archivo.
+   */
+  std::string tempFile() {
+    return (this->work_dir / ("run-" + std::to_string(this->temp_count++)
+        + ".bin")).string();
+  }
+
+  /**
+   * @brief Lee el archivo de entrada por bloques, ordena cada bloque y lo
+   * escribe como una corrida.
+   *
+   * El Merge Sort paralelo usa un buffer del mismo tamaño que el bloque,
+   * por lo que cada bloque ocupa la mitad de la memoria disponible.
+   *
+   * @param input Ruta del archivo a ordenar.
+   * @param runs Salida: rutas de las corridas, en orden.
+   * @return true Si todas las corridas se escribieron.
+   */
+  bool createRuns(const std::string& input, std::vector<std::string>& runs) {
+    std::FILE* file = std::fopen(input.c_str(), "rb");
+    if (file == nullptr) {
+      std::cerr << "No se pudo abrir " << input << std::endl;
+      return false;
+    }
+
+    // Los archivos pequeños no necesitan un bloque del tamaño de la memoria,
+    // y Ordenador no ordena bloques de más de INT_MAX elementos.
+    std::size_t chunk_len = std::min<std::size_t>(
+        this->memory / (2 * sizeof(Element)),
+        std::numeric_limits<int>::max());
+    std::error_code error;
+    const std::uintmax_t file_size = std::filesystem::file_size(input, error);
+    if (!error) {
+      if (file_size % sizeof(Element) != 0) {
+        std::cerr << "El tamaño de " << input << " no es múltiplo de "
+                  << sizeof(Element) << " bytes." << std::endl;
+        std::fclose(file);
+        return false;
+      }
+      chunk_len = std::min<std::uintmax_t>(chunk_len,
+          file_size / sizeof(Element) + 1);
+    }
+
+    const Ordenador sorter;
+    std::vector<Element> chunk(chunk_len);
+    bool success = true;
+    while (success) {
+      // Leer bytes en lugar de elementos para notar un elemento incompleto
+      // al final, si el tamaño no se conocía de antemano.
+      const std::size_t bytes = std::fread(chunk.data(), 1,
+          chunk.size() * sizeof(Element), file);
+      if (bytes < chunk.size() * sizeof(Element) && std::ferror(file) != 0) {
+        std::cerr << "No se pudo leer " << input << std::endl;
+        success = false;
+        break;
+      }
+      if (bytes % sizeof(Element) != 0) {
+        std::cerr << "El tamaño de " << input << " no es múltiplo de "
+                  << sizeof(Element) << " bytes." << std::endl;
+        success = false;
+        break;
+      }
+      const std::size_t length = bytes / sizeof(Element);
+      if (length == 0) { break; }
+
+      sorter.ordenamientoPorMezclaParalelo(chunk.begin(),
+          chunk.begin() + length, std::less<>(), this->threads);
+      // Ordenador no lanza excepciones: si rechaza el bloque lo deja igual,
+      // y una corrida desordenada arruinaría la mezcla.
+      if (!std::is_sorted(chunk.begin(), chunk.begin() + length)) {
+        std::cerr << "No se pudo ordenar un bloque de " << input << std::endl;
+        success = false;
+        break;
+      }
+      runs.push_back(this->tempFile());
+      RunWriter writer(runs.back(), 0);
+      writer.write(chunk.data(), length);
+      if (!writer.close()) {
+        std::cerr << "No se pudo escribir " << runs.back() << std::endl;
+        success = false;
+      }
+      this->report.elements += length;
+    }
+    std::fclose(file);
+    return success;
+  }
+
+  /**
+   * @brief Mezcla las corridas en pasadas hasta dejar una sola en output.
+   *
+   * @param runs Rutas de las corridas, en orden. Se consumen.
+   * @param output Ruta del archivo ordenado.
+   * @return true Si la mezcla terminó.
+   */
+  bool mergeRuns(std::vector<std::string>& runs, const std::string& output) {
+    // Un buffer por corrida más uno de salida, cada uno de al menos
+    // min_buffer bytes.
+    const std::size_t fan_in = std::clamp<std::size_t>(
+        this->memory / ExternalSorter::min_buffer - 1, 2,
+        ExternalSorter::max_fan_in);
+    this->report.fan_in = fan_in;
+
+    // Un archivo vacío produce un archivo vacío.
+    if (runs.empty()) {
+      RunWriter writer(output, 1);
+      return this->checkClose(writer, output);
+    }
+
+    while (runs.size() > fan_in) {
+      std::vector<std::string> merged;
+      for (std::size_t first = 0; first < runs.size(); first += fan_in) {
+        const std::size_t last = std::min(runs.size(), first + fan_in);
+        merged.push_back(this->tempFile());
+        if (!this->mergeGroup(runs, first, last, merged.back())) {
+          return false;
+        }
+      }
+      runs = std::move(merged);
+      ++this->report.merge_passes;
+    }
+
+    // Una sola corrida ya es el resultado, si se puede mover sin copiarla.
+    std::error_code error;
+    if (runs.size() == 1) {
+      std::filesystem::rename(runs[0], output, error);
+      if (!error) { return true; }
+    }
+    ++this->report.merge_passes;
+    return this->mergeGroup(runs, 0, runs.size(), output);
+  }
+
+  /**
+   * @brief Mezcla las corridas [first, last) en un archivo y las borra.
+   *
+   * @param runs Rutas de las corridas.
+   * @param first Primera corrida del grupo.
+   * @param last Índice siguiente a la última corrida del grupo.
+   * @param output Ruta del archivo resultante.
+   * @return true Si la mezcla terminó.
+   */
+  bool mergeGroup(const std::vector<std::string>& runs,
+      const std::size_t first, const std::size_t last,
+      const std::string& output) {
+    const std::size_t count = last - first;
+    const std::size_t buffer_len = this->memory
+        / ((count + 1) * sizeof(Element));
+
+    std::vector<std::unique_ptr<RunReader>> readers;
+    LoserTree tree(count);
+    for (std::size_t leaf = 0; leaf < count; ++leaf) {
+      readers.push_back(std::make_unique<RunReader>(runs[first + leaf],
+          buffer_len));
+      Element value = 0;
+      if (readers.back()->next(value)) { tree.set(leaf, value); }
+    }
+    tree.build();
+
+    {
+      RunWriter writer(output, buffer_len);
+      while (!tree.empty()) {
+        writer.put(tree.top());
+        Element value = 0;
+        const bool available = readers[tree.winner()]->next(value);
+        tree.replaceTop(value, available);
+      }
+      if (!this->checkClose(writer, output)) { return false; }
+    }
+
+    for (std::size_t leaf = 0; leaf < count; ++leaf) {
+      if (readers[leaf]->error()) {
+        std::cerr << "No se pudo leer " << runs[first + leaf] << std::endl;
+        return false;
+      }
+      readers[leaf].reset();
+      std::error_code error;
+      std::filesystem::remove(runs[first + leaf], error);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Cierra un archivo de salida e imprime un error si falló.
+   *
+   * @param writer Archivo a cerrar.
+   * @param path Ruta del archivo, usada para impresión.
+   * @return true Si todas las escrituras fueron exitosas.
+   */
+  static bool checkClose(RunWriter& writer, const std::string& path) {
+    if (writer.close()) { return true; }
+    std::cerr << "No se pudo escribir " << path << std::endl;
+    return false;
+  }
+};
@@ -0,0 +1,236 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Genera los arreglos de entrada de las pruebas de ordenamiento con
+ * distintas distribuciones.
+ *
+ * Todas las distribuciones son deterministas para una misma semilla, por lo
+ * que dos ejecuciones con la misma semilla ordenan los mismos arreglos.
+ */
+class InputGenerator {
+ public:
+  /**
+   * @brief Distribuciones de entrada disponibles.
+   */
+  enum class Distribution {
+    /// Valores uniformes en [0, INT_MAX].
+    kRandom,
+    /// Valores uniformes en [INT_MIN, INT_MAX], incluye negativos.
+    kSigned,
+    /// Valores aleatorios ordenados de forma ascendente.
+    kSorted,
+    /// Valores aleatorios ordenados de forma descendente.
+    kReversed,
+    /// Varias corridas ascendentes seguidas (dientes de sierra).
+    kSawtooth,
+    /// Pocos valores distintos, uniformes en [0, few_unique_values - 1].
+    kFewUnique,
+    /// Valores con distribución de Zipf: pocos valores muy frecuentes y
+    /// muchos poco frecuentes.
+    kZipf,
+    /// Ascendente hasta la mitad y descendente después (tubos de órgano).
+    kOrganPipe,
+    /// Ordenado excepto por algunos pares de elementos intercambiados.
+    kNearlySorted
+  };
+
+  /// Cantidad de valores distintos de la distribución kFewUnique.
+  static constexpr int few_unique_values = 16;
+  /// Cantidad de dientes de la distribución kSawtooth.
+  static constexpr std::size_t sawtooth_teeth = 32;
+  /// Porcentaje de elementos fuera de lugar de la distribución
+  /// kNearlySorted.
+  static constexpr double nearly_sorted_percent = 1;
+  /// Exponente de la distribución de Zipf.
+  static constexpr double zipf_exponent = 1;
+  /// Cantidad máxima de valores distintos de la distribución de Zipf.
+  static constexpr std::size_t zipf_max_values = 1 << 20;
+
+  /**
+   * @brief Retorna todas las distribuciones con su nombre.
+   *
+   * @return Lista de pares (distribución, nombre).
+   */
+  static const std::vector<std::pair<Distribution, std::string>>& all() {
+    static const std::vector<std::pair<Distribution, std::string>>
+        distributions = {
+      {Distribution::kRandom, "random"},
+      {Distribution::kSigned, "signed"},
+      {Distribution::kSorted, "sorted"},
+      {Distribution::kReversed, "reversed"},
+      {Distribution::kSawtooth, "sawtooth"},
+      {Distribution::kFewUnique, "few-unique"},
+      {Distribution::kZipf, "zipf"},
+      {Distribution::kOrganPipe, "organ-pipe"},
+      {Distribution::kNearlySorted, "nearly-sorted"}};
+    return distributions;
+  }
+
+  /**
+   * @brief Retorna el nombre de una distribución.
+   *
+   * @param distribution Distribución.
+   * @return std::string Nombre de la distribución.
+   */
+  static std::string name(const Distribution distribution) {
+    for (const auto& [candidate, candidate_name] : InputGenerator::all()) {
+      if (candidate == distribution) { return candidate_name; }
+    }
+    return "unknown";
+  }
+
+  /**
+   * @brief Busca una distribución por nombre.
+   *
+   * @param name Nombre de la distribución.
+   * @param distribution Salida: la distribución encontrada.
+   * @return true Si el nombre es válido.
+   * @return false Si no existe una distribución con ese nombre.
+   */
+  static bool parse(const std::string& name, Distribution& distribution) {
+    for (const auto& [candidate, candidate_name] : InputGenerator::all()) {
+      if (candidate_name == name) {
+        distribution = candidate;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Genera un arreglo con la distribución indicada.
+   *
+   * @param distribution Distribución de los valores.
+   * @param arr_len Tamaño del arreglo.
+   * @param seed Semilla del generador de números aleatorios.
+   * @return std::vector<int> Arreglo generado.
+   */
+  static std::vector<int> generate(const Distribution distribution,
+      const std::size_t arr_len, const std::uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::vector<int> arr(arr_len);
+
+    switch (distribution) {
+      case Distribution::kRandom:
+        InputGenerator::fillUniform(arr, generator, 0,
+            std::numeric_limits<int>::max());
+        break;
+      case Distribution::kSigned:
+        InputGenerator::fillUniform(arr, generator,
+            std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+        break;
+      case Distribution::kSorted:
+        InputGenerator::fillUniform(arr, generator, 0,
+            std::numeric_limits<int>::max());
+        std::sort(arr.begin(), arr.end());
+        break;
+      case Distribution::kReversed:
+        InputGenerator::fillUniform(arr, generator, 0,
+            std::numeric_limits<int>::max());
+        std::sort(arr.begin(), arr.end(), std::greater<int>());
+        break;
+      case Distribution::kSawtooth: {
+        const std::size_t tooth = std::max<std::size_t>(1,
+            arr_len / InputGenerator::sawtooth_teeth);
+        for (std::size_t index = 0; index < arr_len; ++index) {
+          arr[index] = static_cast<int>(index % tooth);
+        }
+        break;
+      }
+      case Distribution::kFewUnique:
+        InputGenerator::fillUniform(arr, generator, 0,
+            InputGenerator::few_unique_values - 1);
+        break;
+      case Distribution::kZipf:
+        InputGenerator::fillZipf(arr, generator);
+        break;
+      case Distribution::kOrganPipe:
+        for (std::size_t index = 0; index < arr_len; ++index) {
+          arr[index] = static_cast<int>(std::min(index, arr_len - 1 - index));
+        }
+        break;
+      case Distribution::kNearlySorted:
+        InputGenerator::fillNearlySorted(arr, generator);
+        break;
+    }
+    return arr;
+  }
+
+ private:
+  /**
+   * @brief Llena un arreglo con valores uniformes en [min, max].
+   *
+   * @param arr Arreglo a llenar.
+   * @param generator Generador de números aleatorios.
+   * @param min Mínimo del rango.
+   * @param max Máximo del rango.
+   */
+  static void fillUniform(std::vector<int>& arr,
+      std::mt19937_64& generator, const int min, const int max) {
+    std::uniform_int_distribution<int> distribution(min, max);
+    for (int& value : arr) {
+      value = distribution(generator);
+    }
+  }
+
+  /**
+   * @brief Llena un arreglo con valores de una distribución de Zipf: el
+   * valor de rango k aparece con probabilidad proporcional a 1 / k^s.
+   *
+   * Muestrea por inversión, buscando un número uniforme en la función de
+   * distribución acumulada.
+   *
+   * @param arr Arreglo a llenar.
+   * @param generator Generador de números aleatorios.
+   */
+  static void fillZipf(std::vector<int>& arr, std::mt19937_64& generator) {
+    const std::size_t values = std::max<std::size_t>(1,
+        std::min(arr.size(), InputGenerator::zipf_max_values));
+    std::vector<double> cumulative(values);
+    double total = 0;
+    for (std::size_t rank = 0; rank < values; ++rank) {
+      total += 1 / std::pow(static_cast<double>(rank + 1),
+          InputGenerator::zipf_exponent);
+      cumulative[rank] = total;
+    }
+
+    std::uniform_real_distribution<double> distribution(0, total);
+    for (int& value : arr) {
+      value = static_cast<int>(std::lower_bound(cumulative.begin(),
+          cumulative.end(), distribution(generator)) - cumulative.begin());
+    }
+  }
+
+  /**
+   * @brief Llena un arreglo con valores ascendentes y luego intercambia
+   * algunos pares de posiciones al azar.
+   *
+   * @param arr Arreglo a llenar.
+   * @param generator Generador de números aleatorios.
+   */
+  static void fillNearlySorted(std::vector<int>& arr,
+      std::mt19937_64& generator) {
+    for (std::size_t index = 0; index < arr.size(); ++index) {
+      arr[index] = static_cast<int>(index);
+    }
+    if (arr.empty()) { return; }
+
+    std::uniform_int_distribution<std::size_t> position(0, arr.size() - 1);
+    const std::size_t displaced = static_cast<std::size_t>(arr.size()
+        * InputGenerator::nearly_sorted_percent / 100);
+    for (std::size_t count = 0; count < displaced; count += 2) {
+      std::swap(arr[position(generator)], arr[position(generator)]);
+    }
+  }
+};
@@ -0,0 +1,253 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+/**
+ * @brief Archivo proyectado en memoria con mmap, para leerlo o modificarlo
+ * como un arreglo sin copiarlo a un buffer.
+ *
+ * Las páginas se cargan del disco la primera vez que se tocan (fallos de
+ * página) y los cambios se escriben de vuelta al archivo. Los errores se
+ * imprimen en std::cerr y la operación retorna false. En otros sistemas
+ * operativos ningún archivo se puede proyectar.
+ */
+class MappedFile {
+ public:
+  /**
+   * @brief Sugerencias al sistema sobre cómo se va a recorrer el archivo.
+   */
+  enum class Advice {
+    /// Sin sugerencia.
+    kNormal,
+    /// Recorrido secuencial: leer por adelantado y liberar lo ya leído.
+    kSequential,
+    /// Acceso aleatorio: no leer por adelantado.
+    kRandom,
+    /// Cargar todo el archivo por adelantado.
+    kWillNeed
+  };
+
+ private:
+  /// Descriptor del archivo, -1 si no hay uno abierto.
+  int descriptor = -1;
+  /// Inicio de la proyección, nullptr si no hay una.
+  void* address = nullptr;
+  /// Tamaño del archivo en bytes.
+  std::size_t bytes = 0;
+  /// Ruta del archivo, usada para impresión.
+  std::string path;
+
+ public:
+  MappedFile() = default;
+
+  /**
+   * @brief Libera la proyección y cierra el archivo.
+   */
+  ~MappedFile() { this->close(); }
+
+  MappedFile(const MappedFile& other) = delete;
+  MappedFile(MappedFile&& other) = delete;
+  MappedFile& operator=(const MappedFile& other) = delete;
+  MappedFile& operator=(MappedFile&& other) = delete;
+
+  /**
+   * @brief Retorna todas las sugerencias con su nombre.
+   *
+   * @return Lista de pares (sugerencia, nombre).
+   */
+  static const std::vector<std::pair<Advice, std::string>>& all() {
+    static const std::vector<std::pair<Advice, std::string>> advices = {
+      {Advice::kNormal, "normal"},
+      {Advice::kSequential, "sequential"},
+      {Advice::kRandom, "random"},
+      {Advice::kWillNeed, "willneed"}};
+    return advices;
+  }
+
+  /**
+   * @brief Busca una sugerencia por nombre.
+   *
+   * @param name Nombre de la sugerencia.
+   * @param advice Salida: la sugerencia encontrada.
+   * @return true Si el nombre es válido.
+   */
+  static bool parse(const std::string& name, Advice& advice) {
+    for (const auto& [candidate, candidate_name] : MappedFile::all()) {
+      if (candidate_name == name) {
+        advice = candidate;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Proyecta un archivo existente completo.
+   *
+   * @param file_path Ruta del archivo.
+   * @param writable Si es true los cambios se escriben al archivo, si no, la
+   * proyección es de solo lectura.
+   * @return true Si el archivo se proyectó. Un archivo vacío se abre pero
+   * no se proyecta, y data() es nullptr.
+   */
+  bool open(const std::string& file_path, const bool writable) {
+    this->close();
+    this->path = file_path;
+#ifdef __linux__
+    this->descriptor = ::open(file_path.c_str(), writable ? O_RDWR
+        : O_RDONLY);
+    struct stat status;
+    if (this->descriptor < 0 || fstat(this->descriptor, &status) != 0) {
+      return this->fail("abrir");
+    }
+    this->bytes = static_cast<std::size_t>(status.st_size);
+    return this->map(writable);
+#else
+    (void) writable;
+    return this->fail("abrir");
+#endif
+  }
+
+  /**
+   * @brief Crea o trunca un archivo del tamaño indicado y lo proyecta para
+   * escribirlo.
+   *
+   * @param file_path Ruta del archivo.
+   * @param size Tamaño del archivo en bytes.
+   * @return true Si el archivo se creó y se proyectó.
+   */
+  bool create(const std::string& file_path, const std::size_t size) {
+    this->close();
+    this->path = file_path;
+#ifdef __linux__
+    this->descriptor = ::open(file_path.c_str(), O_RDWR | O_CREAT | O_TRUNC,
+        0644);
+    if (this->descriptor < 0 || ftruncate(this->descriptor,
+        static_cast<off_t>(size)) != 0) {
+      return this->fail("crear");
+    }
+    this->bytes = size;
+    return this->map(/* writable */ true);
+#else
+    (void) size;
+    return this->fail("crear");
+#endif
+  }
+
+  /**
+   * @brief Sugiere al sistema cómo se va a recorrer el archivo desde ahora.
+   *
+   * Es solo una sugerencia: si el sistema no la acepta se ignora.
+   *
+   * @param advice Sugerencia.
+   */
+  void advise(const Advice advice) {
+#ifdef __linux__
+    if (this->address == nullptr) { return; }
+    int flag = MADV_NORMAL;
+    switch (advice) {
+      case Advice::kNormal: flag = MADV_NORMAL; break;
+      case Advice::kSequential: flag = MADV_SEQUENTIAL; break;
+      case Advice::kRandom: flag = MADV_RANDOM; break;
+      case Advice::kWillNeed: flag = MADV_WILLNEED; break;
+    }
+    madvise(this->address, this->bytes, flag);
+#else
+    (void) advice;
+#endif
+  }
+
+  /**
+   * @brief Escribe al disco los cambios pendientes y espera a que terminen.
+   *
+   * @return true Si los cambios se escribieron.
+   */
+  bool sync() {
+#ifdef __linux__
+    if (this->address != nullptr
+        && msync(this->address, this->bytes, MS_SYNC) != 0) {
+      return this->fail("sincronizar");
+    }
+#endif
+    return true;
+  }
+
+  /**
+   * @brief Libera la proyección y cierra el archivo. Los cambios quedan en
+   * el archivo aunque no se haya llamado a sync().
+   */
+  void close() {
+#ifdef __linux__
+    if (this->address != nullptr) { munmap(this->address, this->bytes); }
+    if (this->descriptor >= 0) { ::close(this->descriptor); }
+#endif
+    this->address = nullptr;
+    this->descriptor = -1;
+    this->bytes = 0;
+  }
+
+  /**
+   * @brief Retorna el inicio de la proyección.
+   *
+   * @return void* Inicio de la proyección, nullptr si no hay una.
+   */
+  void* data() const { return this->address; }
+
+  /**
+   * @brief Retorna el tamaño del archivo.
+   *
+   * @return std::size_t Tamaño en bytes.
+   */
+  std::size_t size() const { return this->bytes; }
+
+ private:
+#ifdef __linux__
+  /**
+   * @brief Proyecta el archivo abierto completo, compartido con el archivo.
+   *
+   * @param writable Si la proyección permite escribir.
+   * @return true Si el archivo se proyectó o está vacío.
+   */
+  bool map(const bool writable) {
+    if (this->bytes == 0) { return true; }
+    void* mapped = mmap(nullptr, this->bytes, writable
+        ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, this->descriptor,
+        0);
+    if (mapped == MAP_FAILED) { return this->fail("proyectar"); }
+    this->address = mapped;
+    return true;
+  }
+#endif
+
+  /**
+   * @brief Imprime un error con la causa del sistema y cierra el archivo.
+   *
+   * @param operation Verbo de la operación que falló, usado para impresión.
+   * @return false Siempre.
+   */
+  bool fail(const char* operation) {
+#ifdef __linux__
+    const char* reason = std::strerror(errno);
+#else
+    const char* reason = "no soportado en este sistema";
+#endif
+    std::cerr << "No se pudo " << operation << " " << this->path << ": "
+              << reason << std::endl;
+    this->close();
+    return false;
+  }
+};
@@ -0,0 +1,133 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Política de conteo de operaciones que no cuenta nada.
+ *
+ * Es la política por omisión de BasicOrdenador. Todas sus funciones son
+ * vacías y constexpr, por lo que el compilador las elimina junto con el
+ * cálculo de sus argumentos y los algoritmos quedan igual que sin conteo.
+ */
+struct NoOperationCount {
+  /// Indica si la política cuenta operaciones.
+  static constexpr bool enabled = false;
+
+  /// Registra comparaciones entre elementos.
+  static constexpr void comparison(std::uint64_t = 1) {}
+  /// Registra intercambios de dos elementos.
+  static constexpr void swap(std::uint64_t = 1) {}
+  /// Registra elementos movidos o copiados, sin contar los intercambios.
+  static constexpr void move(std::uint64_t = 1) {}
+  /// Registra una reserva de memoria dinámica para elementos.
+  static constexpr void allocation(std::uint64_t) {}
+};
+
+/**
+ * @brief Cantidad de operaciones hechas por un algoritmo de ordenamiento.
+ */
+struct OperationCounts {
+  /// Comparaciones entre elementos.
+  std::uint64_t comparisons = 0;
+  /// Intercambios de dos elementos.
+  std::uint64_t swaps = 0;
+  /// Elementos movidos o copiados fuera de los intercambios.
+  std::uint64_t moves = 0;
+  /// Reservas de memoria dinámica para elementos.
+  std::uint64_t allocations = 0;
+  /// Bytes reservados en total.
+  std::uint64_t allocated_bytes = 0;
+};
+
+/**
+ * @brief Política de conteo de operaciones que acumula los conteos en
+ * contadores globales.
+ *
+ * Los contadores son atómicos, por lo que también cuentan correctamente los
+ * algoritmos paralelos, aunque esto los hace más lentos. Los conteos sirven
+ * para revisar el comportamiento asintótico, no para medir tiempos.
+ */
+class OperationCount {
+ public:
+  /// Indica si la política cuenta operaciones.
+  static constexpr bool enabled = true;
+
+ private:
+  /// Comparaciones entre elementos.
+  static inline std::atomic<std::uint64_t> comparisons{0};
+  /// Intercambios de dos elementos.
+  static inline std::atomic<std::uint64_t> swaps{0};
+  /// Elementos movidos o copiados.
+  static inline std::atomic<std::uint64_t> moves{0};
+  /// Reservas de memoria dinámica.
+  static inline std::atomic<std::uint64_t> allocations{0};
+  /// Bytes reservados.
+  static inline std::atomic<std::uint64_t> allocated_bytes{0};
+
+ public:
+  /**
+   * @brief Registra comparaciones entre elementos.
+   *
+   * @param count Cantidad de comparaciones.
+   */
+  static void comparison(const std::uint64_t count = 1) {
+    OperationCount::comparisons.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Registra intercambios de dos elementos.
+   *
+   * @param count Cantidad de intercambios.
+   */
+  static void swap(const std::uint64_t count = 1) {
+    OperationCount::swaps.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Registra elementos movidos o copiados, sin contar los
+   * intercambios.
+   *
+   * @param count Cantidad de elementos.
+   */
+  static void move(const std::uint64_t count = 1) {
+    OperationCount::moves.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Registra una reserva de memoria dinámica para elementos.
+   *
+   * @param bytes Tamaño de la reserva.
+   */
+  static void allocation(const std::uint64_t bytes) {
+    OperationCount::allocations.fetch_add(1, std::memory_order_relaxed);
+    OperationCount::allocated_bytes.fetch_add(bytes,
+        std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Pone en cero todos los contadores.
+   */
+  static void reset() {
+    OperationCount::comparisons = 0;
+    OperationCount::swaps = 0;
+    OperationCount::moves = 0;
+    OperationCount::allocations = 0;
+    OperationCount::allocated_bytes = 0;
+  }
+
+  /**
+   * @brief Lee los conteos acumulados desde el último reset().
+   *
+   * @return OperationCounts Conteos acumulados.
+   */
+  static OperationCounts read() {
+    OperationCounts counts;
+    counts.comparisons = OperationCount::comparisons;
+    counts.swaps = OperationCount::swaps;
+    counts.moves = OperationCount::moves;
+    counts.allocations = OperationCount::allocations;
+    counts.allocated_bytes = OperationCount::allocated_bytes;
+    return counts;
+  }
+};
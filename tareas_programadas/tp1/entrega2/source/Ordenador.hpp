@@ -1,8 +1,95 @@
 // Copyright 2024 Jose Manuel Mora Z
 #pragma once
 
-class Ordenador {
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "OperationCounter.hpp"
+#include "SimdSort.hpp"
+#include "WorkStealingPool.hpp"
+
+/**
+ * @brief Extractor de llave por omisión de los Radix Sort: usa el mismo
+ * elemento como llave.
+ */
+struct IdentityKey {
+  /**
+   * @brief Retorna el mismo elemento.
+   *
+   * @param value Elemento.
+   * @return const T& El mismo elemento.
+   */
+  template <typename T>
+  constexpr const T& operator()(const T& value) const noexcept {
+    return value;
+  }
+};
+
+/**
+ * @brief Algoritmos de ordenamiento.
+ *
+ * @tparam Counter Política de conteo de operaciones (comparaciones,
+ * intercambios, movimientos y reservas de memoria). Con NoOperationCount,
+ * la política por omisión de Ordenador, no se cuenta nada y no hay costo.
+ * Con OperationCount los algoritmos acumulan sus operaciones.
+ */
+template <typename Counter = NoOperationCount>
+class BasicOrdenador {
  private:
+  /// Instancia actual de la clase, con la misma política de conteo. Se
+  /// llama distinto del alias global Ordenador, que no cuenta operaciones.
+  using Self = BasicOrdenador;
+
+  /// Tamaño mínimo de un sub-arreglo para dividir su trabajo entre hilos.
+  static constexpr int parallel_cutoff = 1 << 13;
+  /// Tamaño máximo de un sub-arreglo que se ordena por inserción.
+  static constexpr int insertion_cutoff = 24;
+  /// Tamaño mínimo de un sub-arreglo para elegir el pivote con la mediana
+  /// de nueve (ninther) en lugar de la mediana de tres.
+  static constexpr int ninther_cutoff = 128;
+  /// Bits de cada dígito del Radix Sort por bytes.
+  static constexpr int radix_bits = 8;
+  /// Cantidad de valores posibles de un dígito del Radix Sort por bytes.
+  static constexpr int radix_buckets = 1 << Self::radix_bits;
+  /// Tamaño máximo de una cubeta del Radix Sort MSD que se ordena por
+  /// inserción.
+  static constexpr int radix_insertion_cutoff = 64;
+  /// Logaritmo en base 2 de la cantidad de cubetas del Sample Sort. Con 256
+  /// cubetas el índice de cubeta cabe en un byte.
+  static constexpr int sample_log_buckets = 8;
+  /// Cantidad de cubetas del Sample Sort.
+  static constexpr int sample_buckets = 1 << Self::sample_log_buckets;
+  /// Elementos de la muestra por cada cubeta del Sample Sort.
+  static constexpr int sample_oversampling = 16;
+  /// Tamaño máximo de un arreglo que el Sample Sort ordena con Introsort.
+  static constexpr int sample_sort_cutoff = 1 << 16;
+  /// Tamaño mínimo de un arreglo para que el Merge Sort adaptativo lo divida
+  /// en corridas.
+  static constexpr int timsort_min_merge = 32;
+  /// Veces seguidas que debe ganar una corrida para mezclar con galope.
+  static constexpr int timsort_min_gallop = 7;
+
+  /**
+   * @brief Corrida ordenada pendiente de mezclar en el Merge Sort adaptativo.
+   */
+  struct Run {
+    /// Inicio de la corrida.
+    int first;
+    /// Largo de la corrida.
+    int length;
+  };
+
   /* Defina aquí los métodos auxiliares de los
       algoritmos de ordenamiento solamente. */
   // Puede definir cuantos métodos quiera.
@@ -15,8 +102,13 @@ class Ordenador {
    * @return true Si el arreglo es válido.
    * @return false Si el arreglo no es válido.
    */
-  bool validateArray(int* A, const int n) const {
-    if (A != nullptr && n > 0) {
+  template <typename RandomIt>
+  bool validateArray(RandomIt A, const int n) const {
+    bool valid = n > 0;
+    if constexpr (std::is_pointer_v<RandomIt>) {
+      valid = valid && A != nullptr;
+    }
+    if (valid) {
       return true;
     } else {
       std::cerr << "El arreglo no es válido." << std::endl;
@@ -25,15 +117,158 @@ class Ordenador {
   }
 
   /**
-   * @brief Intercambia los valores de dos variables enteras.
+   * @brief Valida si un rango [first, last) es válido y calcula su tamaño.
+   *
+   * @param first Inicio del rango.
+   * @param last Fin del rango.
+   * @param n Salida: tamaño del rango.
+   * @return true Si el rango es válido.
+   * @return false Si el rango no es válido.
+   */
+  template <typename RandomIt>
+  bool validateRange(RandomIt first, RandomIt last, int& n) const {
+    const auto length = last - first;
+    if (length > std::numeric_limits<int>::max()) {
+      std::cerr << "El arreglo es demasiado grande." << std::endl;
+      return false;
+    }
+    n = static_cast<int>(length);
+    return this->validateArray(first, n);
+  }
+
+  /**
+   * @brief Envuelve un comparador para que la política cuente cada
+   * comparación. Sin conteo retorna el mismo comparador.
+   *
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @return Comparador equivalente.
+   */
+  template <typename Compare>
+  static auto counted(Compare comp) {
+    if constexpr (Counter::enabled) {
+      return [comp](const auto& a, const auto& b) mutable {
+        Counter::comparison();
+        return comp(a, b);
+      };
+    } else {
+      return comp;
+    }
+  }
+
+  /**
+   * @brief Buffer auxiliar de n elementos.
+   *
+   * Con tipos trivialmente copiables y construibles por omisión, como int,
+   * la memoria se reserva sin inicializar, ya que los algoritmos escriben
+   * cada posición antes de leerla. Los demás tipos pueden no tener
+   * constructor por omisión, por lo que el buffer se construye copiando el
+   * rango.
+   *
+   * @tparam T Tipo de los elementos.
+   */
+  template <typename T>
+  class ScratchBuffer {
+   public:
+    /// Indica si la memoria se reserva sin inicializar.
+    static constexpr bool uninitialized = std::is_trivially_copyable_v<T>
+        && std::is_trivially_default_constructible_v<T>;
+
+    /**
+     * @brief Reserva el buffer.
+     *
+     * @param first Inicio del rango, copiado solo si el tipo no es trivial.
+     * @param n Tamaño del rango.
+     */
+    template <typename RandomIt>
+    ScratchBuffer(RandomIt first, const int n) {
+      if constexpr (uninitialized) {
+        this->raw.reset(new T[n]);
+      } else {
+        this->copy.assign(first, first + n);
+        Counter::move(n);
+      }
+      Counter::allocation(sizeof(T) * n);
+    }
+
+    /**
+     * @brief Retorna el inicio del buffer.
+     *
+     * @return T* Inicio del buffer.
+     */
+    T* data() {
+      if constexpr (uninitialized) {
+        return this->raw.get();
+      } else {
+        return this->copy.data();
+      }
+    }
+
+   private:
+    /// Memoria sin inicializar de los tipos triviales.
+    std::unique_ptr<T[]> raw;
+    /// Copia del rango de los demás tipos.
+    std::vector<T> copy;
+  };
+
+  /**
+   * @brief Copia un arreglo en paralelo, por bloques.
+   *
+   * @param pool Pool de hilos que ejecuta las tareas.
+   * @param source Arreglo a copiar.
+   * @param n Tamaño del arreglo.
+   * @param destination Arreglo de destino.
+   */
+  template <typename SourceIt, typename DestinationIt>
+  static void parallelCopy(WorkStealingPool& pool, SourceIt source,
+      const int n, DestinationIt destination) {
+    const int chunks = std::max(n / Self::parallel_cutoff, 1);
+    pool.parallelFor(0, chunks, [&](const std::size_t chunk) {
+      const int begin = static_cast<int>(int64_t(n) * int64_t(chunk)
+          / chunks);
+      const int end = static_cast<int>(int64_t(n) * int64_t(chunk + 1)
+          / chunks);
+      std::copy(source + begin, source + end, destination + begin);
+    });
+    Counter::move(n);
+  }
+
+  /**
+   * @brief Intercambia los valores de dos variables.
    *
    * @param a Primera variable.
    * @param b Segunda variable.
    */
-  static inline void swap(int& a, int& b) {
-    int temp = a;
-    a = b;
-    b = temp;
+  template <typename T>
+  static inline void swap(T& a, T& b) {
+    Counter::swap();
+    T temp = std::move(a);
+    a = std::move(b);
+    b = std::move(temp);
+  }
+
+  /**
+   * @brief Sección principal del Selection Sort.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare>
+  static void selectionSort(RandomIt A, const int n, Compare comp) {
+    for (int i = 0; i < n - 1; ++i) {
+      // Seleccionar el elemento más pequeño en A[i:n]
+      int min = i;
+      for (int j = i + 1; j < n; ++j) {
+        if (comp(A[j], A[min])) {
+          // Guardar el índice en m.
+          min = j;
+        }
+      }
+      // Intercambiar A[i] con el A[min] resultante.
+      if (min != i) {
+        Self::swap(A[min], A[i]);
+      }
+    }
   }
 
   /**
@@ -44,17 +279,20 @@ class Ordenador {
    * @param A Arreglo a ordenar.
    * @param first Índice de la primera posición en el arreglo.
    * @param last Índice de la última posición en el arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
    */
-  void mergeSort(int* A, const int first, const int last) const {
+  template <typename RandomIt, typename Compare>
+  void mergeSort(RandomIt A, const int first, const int last, Compare comp)
+      const {
     // Revisar si el arreglo solo tiene un elemento o está vacío.
     if (first >= last) { return; }
 
     int mid = (first + last) / 2;
     // Ordenar cada mitad
-    this->mergeSort(A, first, mid);
-    this->mergeSort(A, mid + 1, last);
+    this->mergeSort(A, first, mid, comp);
+    this->mergeSort(A, mid + 1, last, comp);
     // Mezclar las dos mitades, ordenadas.
-    merge(A, first, mid, last);
+    merge(A, first, mid, last, comp);
   }
 
   /**
@@ -65,30 +303,30 @@ class Ordenador {
    * @param first Índice de la primera posición en el arreglo.
    * @param mid Índice de la posición a la mitad del arreglo.
    * @param last Índice de la última posición en el arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
    */
-  void merge(int* A, const int first, const int mid, const int last) const {
+  template <typename RandomIt, typename Compare>
+  void merge(RandomIt A, const int first, const int mid, const int last,
+      Compare comp) const {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
     // Calcular las longitudes de los dos arreglos.
     int leftLen = mid - first + 1;
     int rightLen = last - mid;
 
-    // Sub-arreglos para ordenar.
-    int* leftArr = new int[leftLen];
-    int* rightArr = new int[rightLen];
-
-    // Copiar los elementos a los sub-arreglos.
-    for (int i = 0; i < leftLen; ++i) {
-      leftArr[i] = A[first + i];
-    }
-    for (int j = 0; j < rightLen; ++j) {
-      rightArr[j] = A[mid + 1 + j];
-    }
+    // Sub-arreglos para ordenar, con copias de los elementos.
+    std::vector<T> leftArr(A + first, A + mid + 1);
+    std::vector<T> rightArr(A + mid + 1, A + last + 1);
+    Counter::allocation(sizeof(T) * leftLen);
+    Counter::allocation(sizeof(T) * rightLen);
+    // Copiar a los sub-arreglos y de vuelta al arreglo.
+    Counter::move(2 * (leftLen + rightLen));
 
     // Índices para los sub-arreglos y el arreglo principal.
     int i = 0, j = 0, k = first;
 
     // Mezclar los sub-arreglos temporales, de forma ordenada.
     while (i < leftLen && j < rightLen) {
-      if (leftArr[i] <= rightArr[j]) {
+      if (!comp(rightArr[j], leftArr[i])) {
         A[k++] = leftArr[i++];
       } else {
         A[k++] = rightArr[j++];
@@ -102,10 +340,653 @@ class Ordenador {
     while (j < rightLen) {
       A[k++] = rightArr[j++];
     }
+  }
+
+  /**
+   * @brief Mezcla dos sub-arreglos ordenados en un arreglo de salida distinto.
+   *
+   * Ante elementos iguales toma primero los del sub-arreglo izquierdo, por lo
+   * que la mezcla es estable.
+   *
+   * @param left Sub-arreglo izquierdo.
+   * @param leftLen Tamaño del sub-arreglo izquierdo.
+   * @param right Sub-arreglo derecho.
+   * @param rightLen Tamaño del sub-arreglo derecho.
+   * @param output Arreglo de salida, con espacio para leftLen + rightLen.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename InputIt, typename OutputIt, typename Compare>
+  static void mergeInto(InputIt left, const int leftLen, InputIt right,
+      const int rightLen, OutputIt output, Compare comp) {
+    Counter::move(leftLen + rightLen);
+    int i = 0, j = 0, k = 0;
+    while (i < leftLen && j < rightLen) {
+      if (!comp(right[j], left[i])) {
+        output[k++] = left[i++];
+      } else {
+        output[k++] = right[j++];
+      }
+    }
+    while (i < leftLen) {
+      output[k++] = left[i++];
+    }
+    while (j < rightLen) {
+      output[k++] = right[j++];
+    }
+  }
+
+  /**
+   * @brief Merge Sort sin memoria dinámica por mezcla. Alterna los papeles
+   * del arreglo y del buffer en cada nivel de la recursión (ping-pong), de
+   * modo que cada mezcla escribe directamente en el arreglo del nivel
+   * superior y nunca hay que copiar de vuelta.
+   *
+   * Antes de la primera llamada source y destination deben tener los mismos
+   * elementos en el rango [first, last].
+   *
+   * @param source Arreglo del que se leen las mitades ordenadas.
+   * @param destination Arreglo donde queda el rango ordenado.
+   * @param first Índice de la primera posición en el arreglo.
+   * @param last Índice de la última posición en el arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename SourceIt, typename DestinationIt, typename Compare>
+  void pingPongMergeSort(SourceIt source, DestinationIt destination,
+      const int first, const int last, Compare comp) const {
+    // Un solo elemento ya está ordenado, y es igual en ambos arreglos.
+    if (first >= last) { return; }
+
+    int mid = first + (last - first) / 2;
+    // Ordenar cada mitad dejando el resultado en source.
+    this->pingPongMergeSort(destination, source, first, mid, comp);
+    this->pingPongMergeSort(destination, source, mid + 1, last, comp);
+    // Mezclar las dos mitades de source en destination.
+    Self::mergeInto(source + first, mid - first + 1, source + mid + 1,
+        last - mid, destination + first, comp);
+  }
+
+  /**
+   * @brief Versión paralela del Merge Sort con ping-pong. Ordena cada mitad
+   * en paralelo y luego las mezcla en paralelo de source a destination.
+   *
+   * Antes de la primera llamada source y destination deben tener los mismos
+   * elementos en el rango [first, last].
+   *
+   * @param pool Pool de hilos que ejecuta las tareas.
+   * @param source Arreglo del que se leen las mitades ordenadas.
+   * @param destination Arreglo donde queda el rango ordenado.
+   * @param first Índice de la primera posición en el arreglo.
+   * @param last Índice de la última posición en el arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename SourceIt, typename DestinationIt, typename Compare>
+  void parallelMergeSort(WorkStealingPool& pool, SourceIt source,
+      DestinationIt destination, const int first, const int last,
+      Compare comp) const {
+    // Los sub-arreglos pequeños no compensan el costo de crear tareas.
+    if (last - first + 1 <= Self::parallel_cutoff) {
+      this->pingPongMergeSort(source, destination, first, last, comp);
+      return;
+    }
+
+    int mid = first + (last - first) / 2;
+    // Ordenar cada mitad en paralelo, dejando el resultado en source.
+    pool.invoke([&] {
+      this->parallelMergeSort(pool, destination, source, first, mid, comp);
+    }, [&] {
+      this->parallelMergeSort(pool, destination, source, mid + 1, last, comp);
+    });
+    // Mezclar las dos mitades de source en destination.
+    this->parallelMerge(pool, source + first, mid - first + 1,
+        source + mid + 1, last - mid, destination + first, comp);
+  }
+
+  /**
+   * @brief Mezcla dos sub-arreglos ordenados en paralelo.
+   *
+   * Toma el elemento central del sub-arreglo más grande y busca con búsqueda
+   * binaria su posición en el otro, lo que divide la mezcla en dos mezclas
+   * independientes. Conserva la estabilidad de mergeInto().
+   *
+   * @param pool Pool de hilos que ejecuta las tareas.
+   * @param left Sub-arreglo izquierdo.
+   * @param leftLen Tamaño del sub-arreglo izquierdo.
+   * @param right Sub-arreglo derecho.
+   * @param rightLen Tamaño del sub-arreglo derecho.
+   * @param output Arreglo de salida, con espacio para leftLen + rightLen.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename InputIt, typename OutputIt, typename Compare>
+  void parallelMerge(WorkStealingPool& pool, InputIt left, const int leftLen,
+      InputIt right, const int rightLen, OutputIt output, Compare comp) const {
+    if (leftLen + rightLen <= Self::parallel_cutoff) {
+      Self::mergeInto(left, leftLen, right, rightLen, output, comp);
+      return;
+    }
+
+    int leftMid = 0, rightMid = 0;
+    if (leftLen >= rightLen) {
+      // Los elementos de la derecha menores que left[leftMid] van antes.
+      leftMid = leftLen / 2;
+      rightMid = std::lower_bound(right, right + rightLen, left[leftMid],
+          comp) - right;
+    } else {
+      // Los elementos de la izquierda menores o iguales a right[rightMid]
+      // van antes.
+      rightMid = rightLen / 2;
+      leftMid = std::upper_bound(left, left + leftLen, right[rightMid],
+          comp) - left;
+    }
+
+    pool.invoke([&] {
+      this->parallelMerge(pool, left, leftMid, right, rightMid, output,
+          comp);
+    }, [&] {
+      this->parallelMerge(pool, left + leftMid, leftLen - leftMid,
+          right + rightMid, rightLen - rightMid, output + leftMid + rightMid,
+          comp);
+    });
+  }
+
+  /**
+   * @brief Calcula el largo mínimo de las corridas del Merge Sort adaptativo.
+   *
+   * Retorna un valor entre min_merge / 2 y min_merge tal que n / minRun sea
+   * una potencia de 2 o un poco menos, para que las mezclas queden
+   * balanceadas.
+   *
+   * @param n Tamaño del arreglo.
+   * @return int Largo mínimo de una corrida.
+   */
+  static int minRunLength(int n) {
+    int remainder = 0;
+    while (n >= Self::timsort_min_merge) {
+      remainder |= n & 1;
+      n >>= 1;
+    }
+    return n + remainder;
+  }
+
+  /**
+   * @brief Encuentra la corrida que empieza en first y la deja ascendente.
+   *
+   * Una corrida es ascendente si cada elemento es mayor o igual al anterior,
+   * o estrictamente descendente. Las descendentes se invierten; que sean
+   * estrictas mantiene la estabilidad.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param first Inicio de la corrida.
+   * @param last Índice siguiente al último elemento del arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @return int Largo de la corrida.
+   */
+  template <typename RandomIt, typename Compare>
+  static int countRunAndMakeAscending(RandomIt Arr, const int first,
+      const int last, Compare comp) {
+    int run_end = first + 1;
+    if (run_end == last) { return 1; }
+
+    if (comp(Arr[run_end++], Arr[first])) {
+      // Descendente.
+      while (run_end < last && comp(Arr[run_end], Arr[run_end - 1])) {
+        ++run_end;
+      }
+      Counter::swap((run_end - first) / 2);
+      std::reverse(Arr + first, Arr + run_end);
+    } else {
+      // Ascendente.
+      while (run_end < last && !comp(Arr[run_end], Arr[run_end - 1])) {
+        ++run_end;
+      }
+    }
+    return run_end - first;
+  }
+
+  /**
+   * @brief Ordena un rango con Insertion Sort binario, sabiendo que
+   * [first, start) ya está ordenado.
+   *
+   * Busca la posición de cada elemento con búsqueda binaria y desplaza el
+   * bloque de una vez. Es estable.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param first Inicio del rango.
+   * @param last Índice siguiente al último elemento del rango.
+   * @param start Primer elemento que no está ordenado.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare>
+  static void binaryInsertionSort(RandomIt Arr, const int first,
+      const int last, int start, Compare comp) {
+    if (start == first) { ++start; }
+    for (; start < last; ++start) {
+      auto pivot = std::move(Arr[start]);
+      // Después de los iguales, para mantener la estabilidad.
+      RandomIt position = std::upper_bound(Arr + first, Arr + start, pivot,
+          comp);
+      std::move_backward(position, Arr + start, Arr + start + 1);
+      *position = std::move(pivot);
+      Counter::move(Arr + start - position + 2);
+    }
+  }
+
+  /**
+   * @brief Busca con galope (búsqueda exponencial y luego binaria) la
+   * posición más a la izquierda donde insertar key en un rango ordenado.
+   *
+   * @param key Valor a buscar.
+   * @param Arr Inicio del rango ordenado.
+   * @param length Largo del rango.
+   * @param hint Posición donde empezar la búsqueda.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @return int k tal que Arr[k - 1] < key <= Arr[k].
+   */
+  template <typename T, typename RandomIt, typename Compare>
+  static int gallopLeft(const T& key, RandomIt Arr, const int length,
+      const int hint, Compare comp) {
+    int last_offset = 0;
+    int offset = 1;
+    if (comp(Arr[hint], key)) {
+      // Galopar a la derecha hasta Arr[hint + last_offset] < key <=
+      // Arr[hint + offset].
+      const int max_offset = length - hint;
+      while (offset < max_offset && comp(Arr[hint + offset], key)) {
+        last_offset = offset;
+        offset = Self::nextGallopOffset(offset, max_offset);
+      }
+      offset = std::min(offset, max_offset);
+      last_offset += hint;
+      offset += hint;
+    } else {
+      // Galopar a la izquierda hasta Arr[hint - offset] < key <=
+      // Arr[hint - last_offset].
+      const int max_offset = hint + 1;
+      while (offset < max_offset && !comp(Arr[hint - offset], key)) {
+        last_offset = offset;
+        offset = Self::nextGallopOffset(offset, max_offset);
+      }
+      offset = std::min(offset, max_offset);
+      const int temp = last_offset;
+      last_offset = hint - offset;
+      offset = hint - temp;
+    }
+    // Búsqueda binaria en (last_offset, offset].
+    return static_cast<int>(std::lower_bound(Arr + (last_offset + 1),
+        Arr + offset, key, comp) - Arr);
+  }
+
+  /**
+   * @brief Busca con galope la posición más a la derecha donde insertar key
+   * en un rango ordenado.
+   *
+   * @param key Valor a buscar.
+   * @param Arr Inicio del rango ordenado.
+   * @param length Largo del rango.
+   * @param hint Posición donde empezar la búsqueda.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @return int k tal que Arr[k - 1] <= key < Arr[k].
+   */
+  template <typename T, typename RandomIt, typename Compare>
+  static int gallopRight(const T& key, RandomIt Arr, const int length,
+      const int hint, Compare comp) {
+    int last_offset = 0;
+    int offset = 1;
+    if (comp(key, Arr[hint])) {
+      // Galopar a la izquierda hasta Arr[hint - offset] <= key <
+      // Arr[hint - last_offset].
+      const int max_offset = hint + 1;
+      while (offset < max_offset && comp(key, Arr[hint - offset])) {
+        last_offset = offset;
+        offset = Self::nextGallopOffset(offset, max_offset);
+      }
+      offset = std::min(offset, max_offset);
+      const int temp = last_offset;
+      last_offset = hint - offset;
+      offset = hint - temp;
+    } else {
+      // Galopar a la derecha hasta Arr[hint + last_offset] <= key <
+      // Arr[hint + offset].
+      const int max_offset = length - hint;
+      while (offset < max_offset && !comp(key, Arr[hint + offset])) {
+        last_offset = offset;
+        offset = Self::nextGallopOffset(offset, max_offset);
+      }
+      offset = std::min(offset, max_offset);
+      last_offset += hint;
+      offset += hint;
+    }
+    // Búsqueda binaria en (last_offset, offset].
+    return static_cast<int>(std::upper_bound(Arr + (last_offset + 1),
+        Arr + offset, key, comp) - Arr);
+  }
+
+  /**
+   * @brief Calcula el siguiente salto del galope, 2 * offset + 1, sin
+   * desbordar.
+   *
+   * @param offset Salto actual.
+   * @param max_offset Salto máximo.
+   * @return int Siguiente salto.
+   */
+  static inline int nextGallopOffset(const int offset, const int max_offset) {
+    return offset > (max_offset - 1) / 2 ? max_offset : 2 * offset + 1;
+  }
+
+  /**
+   * @brief Mezcla dos corridas adyacentes, copiando la primera (la más
+   * corta) a un buffer y mezclando de izquierda a derecha.
+   *
+   * Cuando una corrida gana min_gallop veces seguidas, cambia a modo galope
+   * y copia bloques enteros encontrados con gallopLeft() y gallopRight().
+   * Requiere que Arr[first2] < Arr[first1] y que el último elemento de la
+   * primera corrida sea mayor que el de la segunda.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param first1 Inicio de la primera corrida.
+   * @param len1 Largo de la primera corrida.
+   * @param first2 Inicio de la segunda corrida, igual a first1 + len1.
+   * @param len2 Largo de la segunda corrida.
+   * @param buffer Buffer auxiliar, reutilizado entre mezclas.
+   * @param min_gallop Umbral adaptativo para entrar en modo galope.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename T, typename Compare>
+  static void mergeLo(RandomIt Arr, const int first1, int len1,
+      const int first2, int len2, std::vector<T>& buffer, int& min_gallop,
+      Compare comp) {
+    if (buffer.capacity() < static_cast<std::size_t>(len1)) {
+      Counter::allocation(sizeof(T) * len1);
+    }
+    // La corrida copiada se mueve dos veces y la otra una.
+    Counter::move(2 * len1 + len2);
+    buffer.assign(std::make_move_iterator(Arr + first1),
+        std::make_move_iterator(Arr + first1 + len1));
+    int cursor1 = 0;
+    int cursor2 = first2;
+    int destination = first1;
+
+    // Mueve lo que quede de ambas corridas a su lugar final.
+    const auto finish = [&] {
+      if (len1 == 1) {
+        std::move(Arr + cursor2, Arr + cursor2 + len2, Arr + destination);
+        Arr[destination + len2] = std::move(buffer[cursor1]);
+      } else {
+        std::move(buffer.begin() + cursor1, buffer.begin() + cursor1 + len1,
+            Arr + destination);
+      }
+    };
+
+    Arr[destination++] = std::move(Arr[cursor2++]);
+    if (--len2 == 0 || len1 == 1) { return finish(); }
+
+    while (true) {
+      // Veces seguidas que ganó cada corrida.
+      int count1 = 0;
+      int count2 = 0;
+      do {
+        if (comp(Arr[cursor2], buffer[cursor1])) {
+          Arr[destination++] = std::move(Arr[cursor2++]);
+          ++count2;
+          count1 = 0;
+          if (--len2 == 0) { return finish(); }
+        } else {
+          Arr[destination++] = std::move(buffer[cursor1++]);
+          ++count1;
+          count2 = 0;
+          if (--len1 == 1) { return finish(); }
+        }
+      } while ((count1 | count2) < min_gallop);
+
+      // Una corrida está ganando seguido: galopar hasta que deje de valer
+      // la pena.
+      do {
+        count1 = Self::gallopRight(Arr[cursor2],
+            buffer.begin() + cursor1, len1, 0, comp);
+        if (count1 != 0) {
+          std::move(buffer.begin() + cursor1,
+              buffer.begin() + cursor1 + count1, Arr + destination);
+          destination += count1;
+          cursor1 += count1;
+          len1 -= count1;
+          if (len1 <= 1) { return finish(); }
+        }
+        Arr[destination++] = std::move(Arr[cursor2++]);
+        if (--len2 == 0) { return finish(); }
+
+        count2 = Self::gallopLeft(buffer[cursor1], Arr + cursor2, len2,
+            0, comp);
+        if (count2 != 0) {
+          std::move(Arr + cursor2, Arr + cursor2 + count2, Arr + destination);
+          destination += count2;
+          cursor2 += count2;
+          len2 -= count2;
+          if (len2 == 0) { return finish(); }
+        }
+        Arr[destination++] = std::move(buffer[cursor1++]);
+        if (--len1 == 1) { return finish(); }
+        --min_gallop;
+      } while (count1 >= Self::timsort_min_gallop
+          || count2 >= Self::timsort_min_gallop);
+      // Penalizar la salida del modo galope.
+      min_gallop = std::max(min_gallop, 0) + 2;
+    }
+  }
+
+  /**
+   * @brief Mezcla dos corridas adyacentes, copiando la segunda (la más
+   * corta) a un buffer y mezclando de derecha a izquierda.
+   *
+   * Es la imagen en espejo de mergeLo().
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param first1 Inicio de la primera corrida.
+   * @param len1 Largo de la primera corrida.
+   * @param first2 Inicio de la segunda corrida, igual a first1 + len1.
+   * @param len2 Largo de la segunda corrida.
+   * @param buffer Buffer auxiliar, reutilizado entre mezclas.
+   * @param min_gallop Umbral adaptativo para entrar en modo galope.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename T, typename Compare>
+  static void mergeHi(RandomIt Arr, const int first1, int len1,
+      const int first2, int len2, std::vector<T>& buffer, int& min_gallop,
+      Compare comp) {
+    if (buffer.capacity() < static_cast<std::size_t>(len2)) {
+      Counter::allocation(sizeof(T) * len2);
+    }
+    // La corrida copiada se mueve dos veces y la otra una.
+    Counter::move(2 * len2 + len1);
+    buffer.assign(std::make_move_iterator(Arr + first2),
+        std::make_move_iterator(Arr + first2 + len2));
+    // Los cursores apuntan al último elemento pendiente de cada corrida.
+    int cursor1 = first1 + len1 - 1;
+    int cursor2 = len2 - 1;
+    int destination = first2 + len2 - 1;
+
+    // Mueve lo que quede de ambas corridas a su lugar final.
+    const auto finish = [&] {
+      if (len2 == 1) {
+        std::move_backward(Arr + (cursor1 - len1 + 1), Arr + (cursor1 + 1),
+            Arr + (destination + 1));
+        Arr[destination - len1] = std::move(buffer[cursor2]);
+      } else {
+        std::move(buffer.begin(), buffer.begin() + len2,
+            Arr + (destination - len2 + 1));
+      }
+    };
+
+    Arr[destination--] = std::move(Arr[cursor1--]);
+    if (--len1 == 0 || len2 == 1) { return finish(); }
+
+    while (true) {
+      int count1 = 0;
+      int count2 = 0;
+      do {
+        if (comp(buffer[cursor2], Arr[cursor1])) {
+          Arr[destination--] = std::move(Arr[cursor1--]);
+          ++count1;
+          count2 = 0;
+          if (--len1 == 0) { return finish(); }
+        } else {
+          Arr[destination--] = std::move(buffer[cursor2--]);
+          ++count2;
+          count1 = 0;
+          if (--len2 == 1) { return finish(); }
+        }
+      } while ((count1 | count2) < min_gallop);
+
+      do {
+        count1 = len1 - Self::gallopRight(buffer[cursor2], Arr + first1,
+            len1, len1 - 1, comp);
+        if (count1 != 0) {
+          std::move_backward(Arr + (cursor1 - count1 + 1),
+              Arr + (cursor1 + 1), Arr + (destination + 1));
+          destination -= count1;
+          cursor1 -= count1;
+          len1 -= count1;
+          if (len1 == 0) { return finish(); }
+        }
+        Arr[destination--] = std::move(buffer[cursor2--]);
+        if (--len2 == 1) { return finish(); }
+
+        count2 = len2 - Self::gallopLeft(Arr[cursor1], buffer.begin(),
+            len2, len2 - 1, comp);
+        if (count2 != 0) {
+          std::move(buffer.begin() + (cursor2 - count2 + 1),
+              buffer.begin() + (cursor2 + 1),
+              Arr + (destination - count2 + 1));
+          destination -= count2;
+          cursor2 -= count2;
+          len2 -= count2;
+          if (len2 <= 1) { return finish(); }
+        }
+        Arr[destination--] = std::move(Arr[cursor1--]);
+        if (--len1 == 0) { return finish(); }
+        --min_gallop;
+      } while (count1 >= Self::timsort_min_gallop
+          || count2 >= Self::timsort_min_gallop);
+      min_gallop = std::max(min_gallop, 0) + 2;
+    }
+  }
+
+  /**
+   * @brief Mezcla las corridas index e index + 1 de la pila.
+   *
+   * Antes de mezclar descarta los elementos de la primera corrida que ya
+   * están en su lugar y los de la segunda que quedan al final, buscándolos
+   * con galope.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param runs Pila de corridas pendientes.
+   * @param index Posición de la primera corrida en la pila.
+   * @param buffer Buffer auxiliar, reutilizado entre mezclas.
+   * @param min_gallop Umbral adaptativo para entrar en modo galope.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename T, typename Compare>
+  static void mergeRunsAt(RandomIt Arr, std::vector<Run>& runs,
+      const std::size_t index, std::vector<T>& buffer, int& min_gallop,
+      Compare comp) {
+    int first1 = runs[index].first;
+    int len1 = runs[index].length;
+    const int first2 = runs[index + 1].first;
+    int len2 = runs[index + 1].length;
+
+    runs[index].length = len1 + len2;
+    runs.erase(runs.begin() + index + 1);
+
+    // Los elementos de la primera corrida menores o iguales al primero de la
+    // segunda ya están en su lugar.
+    const int skip = Self::gallopRight(Arr[first2], Arr + first1, len1, 0,
+        comp);
+    first1 += skip;
+    len1 -= skip;
+    if (len1 == 0) { return; }
+
+    // Los elementos de la segunda corrida mayores o iguales al último de la
+    // primera también.
+    len2 = Self::gallopLeft(Arr[first1 + len1 - 1], Arr + first2, len2,
+        len2 - 1, comp);
+    if (len2 == 0) { return; }
+
+    if (len1 <= len2) {
+      Self::mergeLo(Arr, first1, len1, first2, len2, buffer, min_gallop,
+          comp);
+    } else {
+      Self::mergeHi(Arr, first1, len1, first2, len2, buffer, min_gallop,
+          comp);
+    }
+  }
+
+  /**
+   * @brief Merge Sort adaptativo al estilo de TimSort.
+   *
+   * Recorre el arreglo buscando corridas ya ordenadas (o invertidas), alarga
+   * las cortas hasta minRunLength(n) con Insertion Sort binario y las apila.
+   * Mezcla las corridas de la pila mientras sus largos no cumplan
+   * runs[i - 2] > runs[i - 1] + runs[i] y runs[i - 1] > runs[i], lo que
+   * mantiene las mezclas balanceadas. Con arreglos casi ordenados encuentra
+   * pocas corridas largas y toma cerca de O(n).
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare>
+  static void timSort(RandomIt Arr, const int n, Compare comp) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    if (n < 2) { return; }
+
+    // Los arreglos pequeños se ordenan con una sola corrida.
+    if (n < Self::timsort_min_merge) {
+      const int run_length =
+          Self::countRunAndMakeAscending(Arr, 0, n, comp);
+      Self::binaryInsertionSort(Arr, 0, n, run_length, comp);
+      return;
+    }
+
+    const int min_run = Self::minRunLength(n);
+    std::vector<Run> runs;
+    std::vector<T> buffer;
+    int min_gallop = Self::timsort_min_gallop;
+
+    int first = 0;
+    while (first < n) {
+      // Encontrar la siguiente corrida y alargarla si es muy corta.
+      int run_length = Self::countRunAndMakeAscending(Arr, first, n,
+          comp);
+      if (run_length < min_run) {
+        const int forced = std::min(n - first, min_run);
+        Self::binaryInsertionSort(Arr, first, first + forced,
+            first + run_length, comp);
+        run_length = forced;
+      }
+      runs.push_back({first, run_length});
+      first += run_length;
+
+      // Restablecer los invariantes de la pila.
+      while (runs.size() > 1) {
+        std::size_t index = runs.size() - 2;
+        if ((index > 0 && runs[index - 1].length
+                <= runs[index].length + runs[index + 1].length)
+            || (index > 1 && runs[index - 2].length
+                <= runs[index - 1].length + runs[index].length)) {
+          if (runs[index - 1].length < runs[index + 1].length) { --index; }
+        } else if (runs[index].length > runs[index + 1].length) {
+          break;
+        }
+        Self::mergeRunsAt(Arr, runs, index, buffer, min_gallop, comp);
+      }
+    }
 
-    // Liberar la memoria dinámica.
-    delete[] rightArr;
-    delete[] leftArr;
+    // Mezclar las corridas que quedan en la pila.
+    while (runs.size() > 1) {
+      std::size_t index = runs.size() - 2;
+      if (index > 0 && runs[index - 1].length < runs[index + 1].length) {
+        --index;
+      }
+      Self::mergeRunsAt(Arr, runs, index, buffer, min_gallop, comp);
+    }
   }
 
   /**
@@ -114,13 +995,16 @@ class Ordenador {
    * @param Arr Arreglo a ordenar.
    * @param arr_len Tamaño del arreglo.
    * @param heap_size Tamaño del heap.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
    */
-  void buildMaxHeap(int* Arr, const int arr_len, int& heap_size) const {
+  template <typename RandomIt, typename Compare>
+  void buildMaxHeap(RandomIt Arr, const int arr_len, int& heap_size,
+      Compare comp) const {
     // Actualizar el tamaño del heap.
     heap_size = arr_len;
     // Construir el heap máximo.
     for (int i = arr_len / 2 - 1; i >= 0; --i) {
-      this->maxHeapify(Arr, i, heap_size);
+      this->maxHeapify(Arr, i, heap_size, comp);
     }
   }
 
@@ -131,8 +1015,11 @@ class Ordenador {
    * @param Arr Arreglo a ordenar.
    * @param index Índice del nodo raíz del sub-árbol.
    * @param heap_size Tamaño del heap.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
    */
-  void maxHeapify(int* Arr, const int index, int& heap_size) const {
+  template <typename RandomIt, typename Compare>
+  void maxHeapify(RandomIt Arr, const int index, int& heap_size,
+      Compare comp) const {
     // Obtener los índices de los hijos.
     int left = this->Left(index);
     int right = this->Right(index);
@@ -140,18 +1027,18 @@ class Ordenador {
     int largest = index;
 
     // Revisar si el hijo izquierdo o derecho es más grande.
-    if (left < heap_size && Arr[left] > Arr[index]) {
+    if (left < heap_size && comp(Arr[index], Arr[left])) {
       largest = left;
     }
-    if (right < heap_size && Arr[right] > Arr[largest]) {
+    if (right < heap_size && comp(Arr[largest], Arr[right])) {
       largest = right;
     }
 
     // Si el nodo no es el más grande, intercambiarlo con el más grande.
     if (largest != index) {
-      Ordenador::swap(Arr[index], Arr[largest]);
+      Self::swap(Arr[index], Arr[largest]);
       // Llamar recursivamente a maxHeapify para el sub-árbol.
-      maxHeapify(Arr, largest, heap_size);
+      maxHeapify(Arr, largest, heap_size, comp);
     }
   }
 
@@ -177,15 +1064,18 @@ class Ordenador {
    * @param Arr Arreglo a ordenar.
    * @param first Primer índice del arreglo.
    * @param last Último índice del arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
    */
-  void quickSort(int* Arr, const int first, const int last) const {
+  template <typename RandomIt, typename Compare>
+  void quickSort(RandomIt Arr, const int first, const int last, Compare comp)
+      const {
     // Revisar si el arreglo solo tiene un elemento o está vacío.
     if (first < last) {
       // Particionar el arreglo.
-      const int pivot = this->partition(Arr, first, last);
+      const int pivot = this->partition(Arr, first, last, comp);
       // Ordenar las dos mitades recursivamente.
-      this->quickSort(Arr, first, pivot - 1);
-      this->quickSort(Arr, pivot + 1, last);
+      this->quickSort(Arr, first, pivot - 1, comp);
+      this->quickSort(Arr, pivot + 1, last, comp);
     }
   }
 
@@ -195,226 +1085,1780 @@ class Ordenador {
    * @param Arr Arreglo a ordenar.
    * @param first Primer índice del arreglo.
    * @param last Último índice del arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
    * @return int Índice del pivote.
    */
-  int partition(int* Arr, const int first, const int last) const {
+  template <typename RandomIt, typename Compare>
+  int partition(RandomIt Arr, const int first, const int last, Compare comp)
+      const {
     // Tomar el último elemento como pivote.
-    int pivot = Arr[last];
+    const auto pivot = Arr[last];
+    Counter::move();
     // Índice para los elementos menores que el pivote.
     int i = first - 1;
     // Ordenar los elementos en relación al pivote.
     for (int j = first; j < last; ++j) {
       // Si el elemento es menor o igual al pivote, intercambiarlo y aumentar i.
-      if (Arr[j] <= pivot) {
-        Ordenador::swap(Arr[++i], Arr[j]);
+      if (!comp(pivot, Arr[j])) {
+        Self::swap(Arr[++i], Arr[j]);
       }
     }
     // Intercambiar el pivote con el elemento en i + 1.
-    Ordenador::swap(Arr[i + 1], Arr[last]);
+    Self::swap(Arr[i + 1], Arr[last]);
     // Retornar la posición del pivote.
     return i + 1;
   }
 
   /**
-   * @brief Encuentra el valor máximo en un arreglo.
+   * @brief Ordena un arreglo con Heap Sort.
    *
-   * @param Arr Arreglo a revisar.
+   * @param Arr Arreglo a ordenar.
    * @param n Tamaño del arreglo.
-   * @return int Valor máximo en el arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
    */
-  int getMax(int* Arr, const int n) const {
-    // Valor máximo en el arreglo (k).
-    int max = Arr[0];
-    // Encontrar el máximo.
-    for (int i = 1; i < n; ++i) {
-      if (Arr[i] > max) {
-        max = Arr[i];
-      }
+  template <typename RandomIt, typename Compare>
+  void heapSort(RandomIt Arr, const int n, Compare comp) const {
+    int heap_size = n;
+    this->buildMaxHeap(Arr, n, heap_size, comp);
+    for (int i = n - 1; i >= 0; --i) {
+      Self::swap(Arr[0], Arr[i]);
+      --heap_size;
+      this->maxHeapify(Arr, 0, heap_size, comp);
     }
-    return max;
   }
 
   /**
-   * @brief Implementación del Counting Sort.
+   * @brief Retorna cuántos niveles debajo de los hijos se piden a memoria
+   * por adelantado en floydSiftDown(), de forma que se pidan entre 8 y 16
+   * elementos contiguos.
    *
-   * @param Arr Arreglo a ordenar.
-   * @param n Tamaño del arreglo.
-   * @param digits Dígitos a considerar.
+   * @tparam Arity Cantidad de hijos de cada nodo.
+   * @return int Cantidad de niveles.
    */
-  void countingSort(int* Arr, const int n, const int digits) const {
-    // Arreglo "B", donde se guardará el resultado.
-    int output[n];
+  template <int Arity>
+  static constexpr int prefetchLevels() {
+    int levels = 0;
+    for (int width = Arity * Arity; width < 8; width *= Arity) {
+      ++levels;
+    }
+    return levels + 1;
+  }
+
+  /**
+   * @brief Coloca un valor en el sub-montículo de raíz index con el método
+   * de Floyd (bottom-up).
+   *
+   * En lugar de comparar el valor contra los hijos en cada nivel, baja el
+   * hueco de index hasta una hoja siguiendo siempre al hijo mayor, y luego
+   * sube el valor desde esa hoja hasta su posición. Como el valor casi
+   * siempre termina cerca de las hojas, hace cerca de la mitad de las
+   * comparaciones que maxHeapify(). El hijo mayor se elige con aritmética
+   * sobre el resultado de la comparación en lugar de un if, por lo que no
+   * hay saltos difíciles de predecir.
+   *
+   * @tparam Arity Cantidad de hijos de cada nodo.
+   * @param Arr Arreglo con el montículo.
+   * @param index Índice del hueco donde empieza el valor.
+   * @param heap_size Tamaño del montículo.
+   * @param value Valor a colocar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <int Arity, typename RandomIt, typename T, typename Compare>
+  static void floydSiftDown(RandomIt Arr, const int index,
+      const int heap_size, T value, Compare comp) {
+    // Los índices se calculan en 64 bits: Arity * hole + 1 desborda un int
+    // en montículos de más de INT_MAX / Arity elementos.
+    int64_t hole = index;
+    // Bajar el hueco hasta una hoja siguiendo al hijo mayor.
+    int64_t child = Arity * hole + 1;
+    while (child + Arity <= heap_size) {
+      // Los descendientes de un mismo nivel son contiguos: pedirlos a
+      // memoria mientras se elige el hijo mayor, ya que la dirección
+      // siguiente depende de esa elección.
+      int64_t descendant = child;
+      int64_t width = Arity;
+      for (int level = 0; level < Self::prefetchLevels<Arity>(); ++level) {
+        descendant = Arity * descendant + 1;
+        width *= Arity;
+      }
+      if (descendant + width <= heap_size) {
+        __builtin_prefetch(&Arr[descendant]);
+        __builtin_prefetch(&Arr[descendant + width - 1]);
+      }
+      int64_t largest = child;
+      if constexpr (Arity == 4) {
+        // Comparar por pares acorta la cadena de dependencias.
+        const int64_t low = child + comp(Arr[child], Arr[child + 1]);
+        const int64_t high = child + 2 + comp(Arr[child + 2], Arr[child + 3]);
+        largest = low + (high - low) * comp(Arr[low], Arr[high]);
+      } else {
+        for (int offset = 1; offset < Arity; ++offset) {
+          largest += (child + offset - largest)
+              * comp(Arr[largest], Arr[child + offset]);
+        }
+      }
+      Arr[hole] = std::move(Arr[largest]);
+      Counter::move();
+      hole = largest;
+      child = Arity * hole + 1;
+    }
+    // El último nodo interno puede tener menos de Arity hijos.
+    if (child < heap_size) {
+      int64_t largest = child;
+      for (int64_t other = child + 1; other < heap_size; ++other) {
+        largest += (other - largest) * comp(Arr[largest], Arr[other]);
+      }
+      Arr[hole] = std::move(Arr[largest]);
+      Counter::move();
+      hole = largest;
+    }
+    // Subir el valor desde la hoja hasta su posición.
+    while (hole > index) {
+      const int64_t parent = (hole - 1) / Arity;
+      if (!comp(Arr[parent], value)) { break; }
+      Arr[hole] = std::move(Arr[parent]);
+      Counter::move();
+      hole = parent;
+    }
+    Arr[hole] = std::move(value);
+    Counter::move();
+  }
+
+  /**
+   * @brief Construye un montículo máximo con el método de Floyd, desde el
+   * último nodo interno hasta la raíz.
+   *
+   * @tparam Arity Cantidad de hijos de cada nodo.
+   * @param Arr Arreglo con los elementos.
+   * @param n Tamaño del arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <int Arity, typename RandomIt, typename Compare>
+  static void floydBuildHeap(RandomIt Arr, const int n, Compare comp) {
+    for (int i = (n - 2) / Arity; i >= 0; --i) {
+      Counter::move();
+      Self::floydSiftDown<Arity>(Arr, i, n, std::move(Arr[i]), comp);
+    }
+  }
+
+  /**
+   * @brief Ordena un montículo máximo moviendo el máximo al final y
+   * colocando el último elemento desde la raíz, n - 1 veces.
+   *
+   * @tparam Arity Cantidad de hijos de cada nodo.
+   * @param Arr Arreglo con el montículo.
+   * @param n Tamaño del montículo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <int Arity, typename RandomIt, typename Compare>
+  static void floydSortHeap(RandomIt Arr, const int n, Compare comp) {
+    for (int last = n - 1; last > 0; --last) {
+      auto value = std::move(Arr[last]);
+      Arr[last] = std::move(Arr[0]);
+      Counter::move(2);
+      Self::floydSiftDown<Arity>(Arr, 0, last, std::move(value), comp);
+    }
+  }
+
+  /**
+   * @brief Heap Sort iterativo con el método de Floyd.
+   *
+   * @tparam Arity Cantidad de hijos de cada nodo: 2 para el montículo
+   * binario o 4 para uno cuaternario, cuyos hijos comparten línea de caché.
+   * @param Arr Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <int Arity, typename RandomIt, typename Compare>
+  static void floydHeapSort(RandomIt Arr, const int n, Compare comp) {
+    Self::floydBuildHeap<Arity>(Arr, n, comp);
+    Self::floydSortHeap<Arity>(Arr, n, comp);
+  }
+
+  /**
+   * @brief Deja en Arr[0:k-1], ordenados, los k elementos que van primero
+   * en el arreglo completo.
+   *
+   * Mantiene en Arr[0:k-1] un montículo máximo cuaternario con los k
+   * mejores vistos hasta ahora: su raíz es el peor de ellos, y cada
+   * elemento siguiente que va antes que la raíz la reemplaza. Toma
+   * O(n log k) y no usa memoria adicional. El resto del arreglo queda en un
+   * orden indefinido.
+   *
+   * @param Arr Arreglo a revisar.
+   * @param n Tamaño del arreglo.
+   * @param k Cantidad de elementos a conservar, 1 <= k <= n.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare>
+  static void partialHeapSort(RandomIt Arr, const int n, const int k,
+      Compare comp) {
+    Self::floydBuildHeap<4>(Arr, k, comp);
+    for (int i = k; i < n; ++i) {
+      if (comp(Arr[i], Arr[0])) {
+        auto value = std::move(Arr[i]);
+        Arr[i] = std::move(Arr[0]);
+        Counter::move(2);
+        Self::floydSiftDown<4>(Arr, 0, k, std::move(value), comp);
+      }
+    }
+    Self::floydSortHeap<4>(Arr, k, comp);
+  }
+
+  /**
+   * @brief Ordena un rango del arreglo con Insertion Sort.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param first Primer índice del rango.
+   * @param last Último índice del rango.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare>
+  static void insertionSort(RandomIt Arr, const int first, const int last,
+      Compare comp) {
+    for (int i = first + 1; i <= last; ++i) {
+      auto key = std::move(Arr[i]);
+      // Insertar Arr[i] en el sub-arreglo ordenado Arr[first:i-1]
+      int j = i - 1;
+      while (j >= first && comp(key, Arr[j])) {
+        Arr[j + 1] = std::move(Arr[j]);
+        --j;
+      }
+      // Insertar key.
+      Arr[j + 1] = std::move(key);
+      Counter::move(i - j + 1);
+    }
+  }
+
+  /**
+   * @brief Ordena un rango del arreglo con Insertion Sort usando un
+   * centinela.
+   *
+   * Primero lleva el menor elemento al inicio del rango, rotando para
+   * mantener la estabilidad. Como ningún elemento puede pasar al centinela,
+   * el ciclo interno no necesita revisar que j >= first.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param first Primer índice del rango.
+   * @param last Último índice del rango.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare>
+  static void sentinelInsertionSort(RandomIt Arr, const int first,
+      const int last, Compare comp) {
+    if (first >= last) { return; }
+    RandomIt minimum = std::min_element(Arr + first, Arr + last + 1, comp);
+    std::rotate(Arr + first, minimum, minimum + 1);
+    Counter::move(minimum - (Arr + first) + 1);
+
+    for (int i = first + 2; i <= last; ++i) {
+      auto key = std::move(Arr[i]);
+      // Arr[first] <= key, por lo que el ciclo se detiene antes de salir
+      // del rango.
+      int j = i - 1;
+      while (comp(key, Arr[j])) {
+        Arr[j + 1] = std::move(Arr[j]);
+        --j;
+      }
+      Arr[j + 1] = std::move(key);
+      Counter::move(i - j + 1);
+    }
+  }
+
+  /**
+   * @brief Retorna el índice del valor mediano entre tres posiciones.
+   *
+   * @param Arr Arreglo a revisar.
+   * @param a Primera posición.
+   * @param b Segunda posición.
+   * @param c Tercera posición.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @return int Índice del valor mediano.
+   */
+  template <typename RandomIt, typename Compare>
+  static int medianOfThree(RandomIt Arr, const int a, const int b,
+      const int c, Compare comp) {
+    if (comp(Arr[a], Arr[b])) {
+      if (comp(Arr[b], Arr[c])) { return b; }
+      return comp(Arr[a], Arr[c]) ? c : a;
+    }
+    if (comp(Arr[a], Arr[c])) { return a; }
+    return comp(Arr[b], Arr[c]) ? c : b;
+  }
+
+  /**
+   * @brief Elige el pivote de un rango: la mediana de tres (primero, medio y
+   * último) o, en rangos grandes, la mediana de tres medianas (ninther).
+   *
+   * @param Arr Arreglo a revisar.
+   * @param first Primer índice del rango.
+   * @param last Último índice del rango.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @return int Índice del pivote.
+   */
+  template <typename RandomIt, typename Compare>
+  static int choosePivot(RandomIt Arr, const int first, const int last,
+      Compare comp) {
+    const int mid = first + (last - first) / 2;
+    if (last - first + 1 < Self::ninther_cutoff) {
+      return Self::medianOfThree(Arr, first, mid, last, comp);
+    }
+    const int step = (last - first + 1) / 8;
+    return Self::medianOfThree(Arr,
+        Self::medianOfThree(Arr, first, first + step, first + 2 * step,
+            comp),
+        Self::medianOfThree(Arr, mid - step, mid, mid + step, comp),
+        Self::medianOfThree(Arr, last - 2 * step, last - step, last,
+            comp),
+        comp);
+  }
+
+  /**
+   * @brief Sección principal del Introsort.
+   *
+   * Particiona con un pivote elegido por mediana, ordena por inserción los
+   * rangos pequeños y cambia a Heap Sort si la recursión supera el límite de
+   * profundidad. Solo hace recursión sobre la parte más pequeña y continúa
+   * con un ciclo sobre la más grande, por lo que la pila crece a lo sumo
+   * O(log n).
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param first Primer índice del arreglo.
+   * @param last Último índice del arreglo.
+   * @param depth_limit Niveles de partición restantes antes de usar Heap Sort.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare>
+  void introSort(RandomIt Arr, int first, int last, int depth_limit,
+      Compare comp) const {
+    while (last - first + 1 > Self::insertion_cutoff) {
+      if (depth_limit == 0) {
+        // Demasiadas particiones malas, garantizar O(n log n).
+        this->heapSort(Arr + first, last - first + 1, comp);
+        return;
+      }
+      --depth_limit;
+
+      // Mover el pivote al final, donde lo espera partition().
+      Self::swap(Arr[Self::choosePivot(Arr, first, last, comp)],
+          Arr[last]);
+      const int pivot = this->partition(Arr, first, last, comp);
+
+      // Recursión sobre la parte más pequeña, ciclo sobre la más grande.
+      if (pivot - first < last - pivot) {
+        this->introSort(Arr, first, pivot - 1, depth_limit, comp);
+        first = pivot + 1;
+      } else {
+        this->introSort(Arr, pivot + 1, last, depth_limit, comp);
+        last = pivot - 1;
+      }
+    }
+    Self::insertionSort(Arr, first, last, comp);
+  }
+
+#if SIMD_SORT_AVX2
+  /**
+   * @brief Sección principal del Quick Sort vectorizado.
+   *
+   * Igual que introSort(), pero particiona con SimdSort::partition() y
+   * ordena los rangos de hasta SimdSort::max_small elementos con redes de
+   * ordenamiento. Si el pivote es igual al elemento anterior al rango (el
+   * pivote de un nivel superior), todos los menores o iguales son iguales a
+   * él, así que se agrupan y se descartan, lo que evita el peor caso con
+   * muchos valores repetidos. La política de conteo cuenta una comparación
+   * y un movimiento por elemento particionado, pero no las comparaciones
+   * de las redes de ordenamiento.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param first Primer índice del rango.
+   * @param last Último índice del rango.
+   * @param depth_limit Niveles de partición restantes antes de usar Heap Sort.
+   * @param leftmost Indica si el rango empieza al inicio del arreglo, es
+   * decir, si no tiene un elemento anterior.
+   */
+  void vectorizedQuickSort(int* Arr, int first, int last, int depth_limit,
+      bool leftmost) const {
+    while (last - first + 1 > SimdSort::max_small) {
+      if (depth_limit == 0) {
+        Self::floydHeapSort<4>(Arr + first, last - first + 1,
+            Self::counted(std::less<>()));
+        return;
+      }
+      --depth_limit;
+
+      // Mover el pivote al final y particionar el resto del rango.
+      const int pivot_index = Self::choosePivot(Arr, first, last,
+          Self::counted(std::less<>()));
+      const int pivot = Arr[pivot_index];
+      Self::swap(Arr[pivot_index], Arr[last]);
+
+      // Cada partición compara y escribe una vez cada elemento.
+      Counter::comparison(last - first);
+      Counter::move(last - first);
+      if (!leftmost && !(Arr[first - 1] < pivot)) {
+        // Los menores o iguales al pivote son iguales a él.
+        const int equal = first
+            + SimdSort::partition<true>(Arr + first, last - first, pivot);
+        Self::swap(Arr[equal], Arr[last]);
+        first = equal + 1;
+        continue;
+      }
+
+      const int mid = first
+          + SimdSort::partition<false>(Arr + first, last - first, pivot);
+      Self::swap(Arr[mid], Arr[last]);
+
+      // Recursión sobre la parte más pequeña, ciclo sobre la más grande.
+      if (mid - first < last - mid) {
+        this->vectorizedQuickSort(Arr, first, mid - 1, depth_limit, leftmost);
+        first = mid + 1;
+        leftmost = false;
+      } else {
+        this->vectorizedQuickSort(Arr, mid + 1, last, depth_limit, false);
+        last = mid - 1;
+      }
+    }
+    SimdSort::sortSmall(Arr + first, last - first + 1);
+  }
+#endif
+
+  /**
+   * @brief Particiona el arreglo en tres partes (bandera holandesa): menores,
+   * iguales y mayores que el pivote, en una sola pasada.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param first Primer índice del arreglo.
+   * @param last Último índice del arreglo.
+   * @param lt Salida: primer índice de los elementos iguales al pivote.
+   * @param gt Salida: último índice de los elementos iguales al pivote.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare>
+  static void partitionThreeWay(RandomIt Arr, const int first, const int last,
+      int& lt, int& gt, Compare comp) {
+    const auto pivot = Arr[Self::choosePivot(Arr, first, last, comp)];
+    Counter::move();
+    lt = first;
+    gt = last;
+    int i = first;
+    // Invariante: Arr[first:lt-1] < pivote, Arr[lt:i-1] == pivote,
+    // Arr[gt+1:last] > pivote.
+    while (i <= gt) {
+      if (comp(Arr[i], pivot)) {
+        Self::swap(Arr[lt++], Arr[i++]);
+      } else if (comp(pivot, Arr[i])) {
+        Self::swap(Arr[i], Arr[gt--]);
+      } else {
+        ++i;
+      }
+    }
+  }
+
+  /**
+   * @brief Sección principal del Quick Sort de tres vías.
+   *
+   * Igual que introSort(), pero los elementos iguales al pivote quedan en su
+   * posición final tras cada partición y no se vuelven a procesar, por lo
+   * que los arreglos con muchos duplicados se ordenan en tiempo casi lineal.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param first Primer índice del arreglo.
+   * @param last Último índice del arreglo.
+   * @param depth_limit Niveles de partición restantes antes de usar Heap Sort.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare>
+  void threeWayQuickSort(RandomIt Arr, int first, int last, int depth_limit,
+      Compare comp) const {
+    while (last - first + 1 > Self::insertion_cutoff) {
+      if (depth_limit == 0) {
+        this->heapSort(Arr + first, last - first + 1, comp);
+        return;
+      }
+      --depth_limit;
+
+      int lt = 0, gt = 0;
+      Self::partitionThreeWay(Arr, first, last, lt, gt, comp);
+
+      // Recursión sobre la parte más pequeña, ciclo sobre la más grande.
+      if (lt - first < last - gt) {
+        this->threeWayQuickSort(Arr, first, lt - 1, depth_limit, comp);
+        first = gt + 1;
+      } else {
+        this->threeWayQuickSort(Arr, gt + 1, last, depth_limit, comp);
+        last = lt - 1;
+      }
+    }
+    Self::insertionSort(Arr, first, last, comp);
+  }
+
+  /**
+   * @brief Sección principal del Introselect.
+   *
+   * Igual que threeWayQuickSort(), pero después de cada partición solo
+   * continúa con la parte que contiene la posición nth, por lo que toma
+   * O(n) en promedio. Si la recursión supera el límite de profundidad
+   * ordena con Heap Sort el rango que queda, lo que garantiza O(n log n).
+   *
+   * @param Arr Arreglo a revisar.
+   * @param first Primer índice del rango.
+   * @param last Último índice del rango.
+   * @param nth Posición buscada, dentro de [first, last].
+   * @param depth_limit Particiones restantes antes de usar Heap Sort.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare>
+  static void introSelect(RandomIt Arr, int first, int last, const int nth,
+      int depth_limit, Compare comp) {
+    while (last - first + 1 > Self::insertion_cutoff) {
+      if (depth_limit == 0) {
+        Self::floydHeapSort<4>(Arr + first, last - first + 1, comp);
+        return;
+      }
+      --depth_limit;
+
+      int lt = 0, gt = 0;
+      Self::partitionThreeWay(Arr, first, last, lt, gt, comp);
+      // Los iguales al pivote ya están en su posición final.
+      if (nth < lt) {
+        last = lt - 1;
+      } else if (nth > gt) {
+        first = gt + 1;
+      } else {
+        return;
+      }
+    }
+    Self::insertionSort(Arr, first, last, comp);
+  }
+
+  /**
+   * @brief Calcula el límite de profundidad del Introsort, 2 * log2(n).
+   *
+   * @param n Tamaño del arreglo.
+   * @return int Límite de profundidad.
+   */
+  static int introDepthLimit(int n) {
+    int log2 = 0;
+    while (n > 1) {
+      n >>= 1;
+      ++log2;
+    }
+    return 2 * log2;
+  }
+
+  /**
+   * @brief Encuentra el valor máximo en un arreglo.
+   *
+   * @param Arr Arreglo a revisar.
+   * @param n Tamaño del arreglo.
+   * @return int Valor máximo en el arreglo.
+   */
+  int getMax(int* Arr, const int n) const {
+    // Valor máximo en el arreglo (k).
+    int max = Arr[0];
+    Counter::comparison(n - 1);
+    // Encontrar el máximo.
+    for (int i = 1; i < n; ++i) {
+      if (Arr[i] > max) {
+        max = Arr[i];
+      }
+    }
+    return max;
+  }
+
+  /**
+   * @brief Implementación del Counting Sort.
+   *
+   * Distribuye los elementos de source en destination según el dígito
+   * indicado, sin modificar source.
+   *
+   * @param source Arreglo a ordenar.
+   * @param destination Arreglo "B", donde se guardará el resultado.
+   * @param n Tamaño del arreglo.
+   * @param digits Dígitos a considerar.
+   */
+  void countingSort(int* source, int* destination, const int n,
+      const int64_t digits) const {
     // Arreglo auxiliar "C".
     int count[10] = {0};
 
     for (int i = 0; i < n; ++i) {
       // Contar las apariciones de cada "dígito".
-      count[getDigit(Arr, i, digits)]++;
+      count[getDigit(source, i, digits)]++;
+    }
+
+    for (int i = 1; i < 10; ++i) {
+      // Sumar las apariciones de los dígitos anteriores.
+      // Esto indica la posición de cada dígito en el arreglo ordenado.
+      count[i] += count[i - 1];
+    }
+
+    Counter::move(n);
+    // Recorrer el arreglo en orden inverso,
+    // para conservar el orden de los elementos.
+    for (int i = n - 1; i >= 0; --i) {
+      // Agregar los elementos a "B" en la posición indicada por "C", y
+      // disminuir la posición del siguiente elemento del mismo dígito.
+      destination[--count[getDigit(source, i, digits)]] = source[i];
+    }
+  }
+
+  /**
+   * @brief Sección principal del Radix Sort.
+   *
+   * Reserva un solo buffer en memoria dinámica para todas las pasadas y
+   * alterna los papeles del arreglo y el buffer en cada una, en lugar de
+   * copiar el resultado de vuelta tras cada dígito.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   */
+  void radixSort(int* Arr, const int n) const {
+    // Encontrar el valor máximo en el arreglo (k).
+    int max = this->getMax(Arr, n);
+
+    int* buffer = new int[n];
+    Counter::allocation(sizeof(int) * n);
+    int* source = Arr;
+    int* destination = buffer;
+    // Ordenar los elementos por dígito. Se usan 64 bits para que digits no
+    // se desborde con valores mayores a 10^9.
+    for (int64_t digits = 1; max / digits > 0; digits *= 10) {
+      this->countingSort(source, destination, n, digits);
+      std::swap(source, destination);
+    }
+
+    // Si el resultado quedó en el buffer, copiarlo al arreglo original.
+    if (source != Arr) {
+      std::copy(source, source + n, Arr);
+      Counter::move(n);
+    }
+    delete[] buffer;
+  }
+
+  /**
+   * @brief Obtiene el dígito de un número en una posición específica.
+   *
+   * @param Arr Arreglo a revisar.
+   * @param i Índice del elemento en el arreglo.
+   * @param digits Dígitos a considerar.
+   * @return int Dígito en la posición indicada.
+   */
+  int getDigit(int *Arr, int i, const int64_t digits) const {
+    return static_cast<int>((Arr[i] / digits) % 10);
+  }
+
+  /**
+   * @brief Convierte una llave numérica en un entero sin signo con el mismo
+   * orden.
+   *
+   * Los enteros sin signo no cambian. En los enteros con signo se invierte el
+   * bit de signo, para que los negativos queden antes que los positivos. En
+   * los números de punto flotante se invierten todos los bits de los
+   * negativos y solo el bit de signo de los positivos.
+   *
+   * @param value Llave a convertir.
+   * @return Entero sin signo del mismo tamaño que la llave.
+   */
+  template <typename Key>
+  static inline auto radixKey(const Key value) {
+    static_assert(std::is_arithmetic_v<Key> && !std::is_same_v<Key, bool>
+        && sizeof(Key) <= 8, "La llave del Radix Sort debe ser numérica.");
+    if constexpr (std::is_floating_point_v<Key>) {
+      using Bits = std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>;
+      static_assert(sizeof(Key) == sizeof(Bits),
+          "Formato de punto flotante no soportado.");
+      Bits bits = 0;
+      std::memcpy(&bits, &value, sizeof(Bits));
+      const Bits sign = Bits(1) << (sizeof(Bits) * 8 - 1);
+      return (bits & sign) != 0 ? Bits(~bits) : Bits(bits ^ sign);
+    } else {
+      using Bits = std::make_unsigned_t<Key>;
+      Bits bits = static_cast<Bits>(value);
+      if constexpr (std::is_signed_v<Key>) {
+        bits ^= Bits(1) << (sizeof(Bits) * 8 - 1);
+      }
+      return bits;
+    }
+  }
+
+  /**
+   * @brief Obtiene un byte de una llave ya convertida con radixKey().
+   *
+   * @param bits Llave sin signo.
+   * @param pass Número del byte, empezando por el menos significativo.
+   * @return unsigned int Byte en la posición indicada.
+   */
+  template <typename Bits>
+  static inline unsigned int radixByte(const Bits bits, const int pass) {
+    return static_cast<unsigned int>(bits >> (pass * Self::radix_bits))
+        & (Self::radix_buckets - 1);
+  }
+
+  /**
+   * @brief Retorna el byte más significativo de la llave de los elementos
+   * de tipo RandomIt al usar el extractor KeyFn, donde empieza el Radix Sort
+   * MSD.
+   *
+   * @return int Índice del byte más significativo.
+   */
+  template <typename RandomIt, typename KeyFn>
+  static constexpr int radixTopPass() {
+    using Key = std::decay_t<decltype(std::declval<KeyFn&>()(
+        *std::declval<RandomIt&>()))>;
+    return static_cast<int>(sizeof(Key)) - 1;
+  }
+
+  /**
+   * @brief Distribuye de forma estable los elementos de source en
+   * destination según un byte de su llave.
+   *
+   * @param source Elementos a distribuir.
+   * @param n Cantidad de elementos.
+   * @param destination Arreglo de salida del mismo tamaño.
+   * @param next Siguiente posición libre de cada cubeta, se actualiza.
+   * @param pass Byte a considerar.
+   * @param key Extractor de la llave.
+   */
+  template <typename SourceIt, typename DestinationIt, typename KeyFn>
+  static void radixScatter(SourceIt source, const int n,
+      DestinationIt destination, int* next, const int pass, KeyFn key) {
+    Counter::move(n);
+    for (int i = 0; i < n; ++i) {
+      const unsigned int digit =
+          Self::radixByte(Self::radixKey(key(source[i])), pass);
+      destination[next[digit]++] = std::move(source[i]);
     }
+  }
+
+  /**
+   * @brief Radix Sort LSD en base 256.
+   *
+   * Cuenta los histogramas de todos los bytes de la llave en una sola lectura
+   * del arreglo, omite las pasadas en las que todas las llaves tienen el
+   * mismo byte y alterna entre el arreglo y un buffer en lugar de copiar de
+   * vuelta en cada pasada.
+   *
+   * @param Arr Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   * @param key Extractor de la llave numérica de cada elemento.
+   */
+  template <typename RandomIt, typename KeyFn>
+  void byteRadixSort(RandomIt Arr, const int n, KeyFn key) const {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    constexpr int passes = Self::radixTopPass<RandomIt, KeyFn>() + 1;
+
+    // Histogramas de cada byte, calculados en una sola pasada.
+    std::array<std::array<int, Self::radix_buckets>, passes> count{};
+    for (int i = 0; i < n; ++i) {
+      const auto bits = Self::radixKey(key(Arr[i]));
+      for (int pass = 0; pass < passes; ++pass) {
+        ++count[pass][Self::radixByte(bits, pass)];
+      }
+    }
+
+    // La primera pasada que distribuye escribe todo el buffer.
+    ScratchBuffer<T> scratch(Arr, n);
+    T* buffer = scratch.data();
+    // Indica si los datos ordenados hasta ahora están en el buffer.
+    bool in_buffer = false;
+    for (int pass = 0; pass < passes; ++pass) {
+      // Si todas las llaves comparten este byte, la pasada no cambia nada.
+      const T& sample = in_buffer ? buffer[0] : Arr[0];
+      if (count[pass][Self::radixByte(Self::radixKey(key(sample)),
+          pass)] == n) {
+        continue;
+      }
+
+      // Convertir el histograma en la posición inicial de cada byte.
+      int offset = 0;
+      for (int digit = 0; digit < Self::radix_buckets; ++digit) {
+        const int digit_count = count[pass][digit];
+        count[pass][digit] = offset;
+        offset += digit_count;
+      }
+
+      // Distribuir de forma estable según el byte.
+      if (in_buffer) {
+        Self::radixScatter(buffer, n, Arr, count[pass].data(),
+            pass, key);
+      } else {
+        Self::radixScatter(Arr, n, buffer, count[pass].data(),
+            pass, key);
+      }
+      in_buffer = !in_buffer;
+    }
+
+    // Si el resultado quedó en el buffer, moverlo al arreglo original.
+    if (in_buffer) {
+      std::move(buffer, buffer + n, Arr);
+      Counter::move(n);
+    }
+  }
+
+  /**
+   * @brief Radix Sort MSD en base 256, secuencial.
+   *
+   * Distribuye los elementos de source en destination según el byte pass y
+   * luego ordena cada cubeta por el byte siguiente, alternando los papeles de
+   * los dos arreglos. Las cubetas pequeñas se ordenan por inserción y los
+   * bytes que comparten todas las llaves se omiten.
+   *
+   * @param source Arreglo con los elementos a ordenar.
+   * @param destination Arreglo auxiliar del mismo tamaño.
+   * @param n Tamaño del arreglo.
+   * @param pass Byte a considerar, empezando por el más significativo.
+   * Si es negativo, el rango ya está ordenado.
+   * @param result_in_source Si es true el resultado debe quedar en source,
+   * si no, en destination.
+   * @param key Extractor de la llave numérica de cada elemento.
+   */
+  template <typename SourceIt, typename DestinationIt, typename KeyFn>
+  void msdRadixSort(SourceIt source, DestinationIt destination, const int n,
+      const int pass, const bool result_in_source, KeyFn key) const {
+    if (n <= Self::radix_insertion_cutoff || pass < 0) {
+      if (pass >= 0) {
+        Self::insertionSort(source, 0, n - 1, Self::counted(
+            [&key](const auto& a, const auto& b) {
+              return Self::radixKey(key(a)) < Self::radixKey(key(b));
+            }));
+      }
+      if (!result_in_source) {
+        std::move(source, source + n, destination);
+        Counter::move(n);
+      }
+      return;
+    }
+
+    int count[Self::radix_buckets] = {};
+    for (int i = 0; i < n; ++i) {
+      ++count[Self::radixByte(Self::radixKey(key(source[i])), pass)];
+    }
+    // Si todas las llaves comparten este byte, pasar al siguiente.
+    if (count[Self::radixByte(Self::radixKey(key(source[0])),
+        pass)] == n) {
+      this->msdRadixSort(source, destination, n, pass - 1, result_in_source,
+          key);
+      return;
+    }
+
+    // Posición inicial de cada cubeta.
+    int start[Self::radix_buckets + 1] = {};
+    for (int digit = 0; digit < Self::radix_buckets; ++digit) {
+      start[digit + 1] = start[digit] + count[digit];
+    }
+    int next[Self::radix_buckets];
+    std::copy(start, start + Self::radix_buckets, next);
+    Self::radixScatter(source, n, destination, next, pass, key);
+
+    // Ordenar cada cubeta, que ahora está en destination.
+    for (int digit = 0; digit < Self::radix_buckets; ++digit) {
+      if (count[digit] > 0) {
+        this->msdRadixSort(destination + start[digit], source + start[digit],
+            count[digit], pass - 1, !result_in_source, key);
+      }
+    }
+  }
+
+  /**
+   * @brief Radix Sort MSD en base 256, paralelo.
+   *
+   * Divide el arreglo en un bloque por hilo. Cada hilo cuenta un histograma
+   * local de su bloque, una suma de prefijos sobre los histogramas define en
+   * qué posición escribe cada hilo cada cubeta, y los hilos distribuyen sus
+   * bloques en paralelo. Luego las cubetas se ordenan en paralelo. Los rangos
+   * pequeños usan msdRadixSort().
+   *
+   * @param pool Pool de hilos que ejecuta las tareas.
+   * @param source Arreglo con los elementos a ordenar.
+   * @param destination Arreglo auxiliar del mismo tamaño.
+   * @param n Tamaño del arreglo.
+   * @param pass Byte a considerar, empezando por el más significativo.
+   * @param result_in_source Si es true el resultado debe quedar en source,
+   * si no, en destination.
+   * @param key Extractor de la llave numérica de cada elemento.
+   */
+  template <typename SourceIt, typename DestinationIt, typename KeyFn>
+  void parallelMsdRadixSort(WorkStealingPool& pool, SourceIt source,
+      DestinationIt destination, const int n, const int pass,
+      const bool result_in_source, KeyFn key) const {
+    if (n <= Self::parallel_cutoff || pass < 0) {
+      this->msdRadixSort(source, destination, n, pass, result_in_source, key);
+      return;
+    }
+
+    // Histograma local de cada bloque.
+    const int chunks = static_cast<int>(pool.size());
+    const int chunk_len = (n + chunks - 1) / chunks;
+    std::vector<std::array<int, Self::radix_buckets>> count(chunks);
+    pool.parallelFor(0, chunks, [&](const std::size_t chunk) {
+      const int begin = static_cast<int>(chunk) * chunk_len;
+      const int end = std::min(n, begin + chunk_len);
+      for (int i = begin; i < end; ++i) {
+        ++count[chunk][Self::radixByte(
+            Self::radixKey(key(source[i])), pass)];
+      }
+    });
+
+    // Posición inicial de cada cubeta y, dentro de ella, de cada bloque.
+    int start[Self::radix_buckets + 1] = {};
+    for (int digit = 0; digit < Self::radix_buckets; ++digit) {
+      int offset = start[digit];
+      for (int chunk = 0; chunk < chunks; ++chunk) {
+        const int chunk_count = count[chunk][digit];
+        count[chunk][digit] = offset;
+        offset += chunk_count;
+      }
+      start[digit + 1] = offset;
+    }
+    // Si todas las llaves comparten este byte, pasar al siguiente.
+    const int digit =
+        Self::radixByte(Self::radixKey(key(source[0])), pass);
+    if (start[digit + 1] - start[digit] == n) {
+      this->parallelMsdRadixSort(pool, source, destination, n, pass - 1,
+          result_in_source, key);
+      return;
+    }
+
+    // Distribuir cada bloque en paralelo.
+    pool.parallelFor(0, chunks, [&](const std::size_t chunk) {
+      const int begin = static_cast<int>(chunk) * chunk_len;
+      const int end = std::min(n, begin + chunk_len);
+      if (begin < end) {
+        Self::radixScatter(source + begin, end - begin, destination,
+            count[chunk].data(), pass, key);
+      }
+    });
+
+    // Ordenar las cubetas en paralelo.
+    pool.parallelFor(0, Self::radix_buckets,
+        [&](const std::size_t bucket) {
+          const int bucket_len = start[bucket + 1] - start[bucket];
+          if (bucket_len > 0) {
+            this->parallelMsdRadixSort(pool, destination + start[bucket],
+                source + start[bucket], bucket_len, pass - 1,
+                !result_in_source, key);
+          }
+        });
+  }
+
+  /**
+   * @brief Radix Sort LSD en base 256, paralelo y estable.
+   *
+   * En cada pasada divide el arreglo en bloques contiguos, cuenta un
+   * histograma por bloque en paralelo, una suma de prefijos recorrida por
+   * byte y luego por bloque define dónde escribe cada bloque cada cubeta, y
+   * los bloques se distribuyen en paralelo. Así los elementos con el mismo
+   * byte conservan el orden de la pasada anterior, y el resultado es el
+   * orden estable, que es único: no depende de la cantidad de hilos. Las
+   * pasadas en las que todas las llaves comparten el byte se omiten.
+   *
+   * @param pool Pool de hilos que ejecuta las tareas.
+   * @param Arr Arreglo a ordenar.
+   * @param buffer Arreglo auxiliar del mismo tamaño.
+   * @param n Tamaño del arreglo.
+   * @param key Extractor de la llave numérica de cada elemento.
+   */
+  template <typename RandomIt, typename BufferIt, typename KeyFn>
+  void parallelLsdRadixSort(WorkStealingPool& pool, RandomIt Arr,
+      BufferIt buffer, const int n, KeyFn key) const {
+    constexpr int passes = Self::radixTopPass<RandomIt, KeyFn>() + 1;
+    // La cantidad de bloques solo depende de n.
+    const int chunks = std::clamp(n / Self::parallel_cutoff, 1,
+        Self::radix_buckets);
+    auto chunkBegin = [n, chunks](const std::size_t chunk) {
+      return static_cast<int>(int64_t(n) * int64_t(chunk) / chunks);
+    };
+    std::vector<std::array<int, Self::radix_buckets>> count(chunks);
+
+    // Distribuye source en destination según el byte pass, si no es común a
+    // todas las llaves. Retorna true si distribuyó.
+    auto distribute = [&](auto source, auto destination, const int pass) {
+      pool.parallelFor(0, chunks, [&](const std::size_t chunk) {
+        count[chunk].fill(0);
+        for (int i = chunkBegin(chunk); i < chunkBegin(chunk + 1); ++i) {
+          ++count[chunk][Self::radixByte(
+              Self::radixKey(key(source[i])), pass)];
+        }
+      });
+
+      const unsigned int first_digit = Self::radixByte(
+          Self::radixKey(key(source[0])), pass);
+      int first_digit_count = 0;
+      for (int chunk = 0; chunk < chunks; ++chunk) {
+        first_digit_count += count[chunk][first_digit];
+      }
+      if (first_digit_count == n) { return false; }
+
+      int offset = 0;
+      for (int digit = 0; digit < Self::radix_buckets; ++digit) {
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+          const int chunk_count = count[chunk][digit];
+          count[chunk][digit] = offset;
+          offset += chunk_count;
+        }
+      }
+
+      pool.parallelFor(0, chunks, [&](const std::size_t chunk) {
+        const int begin = chunkBegin(chunk);
+        Self::radixScatter(source + begin, chunkBegin(chunk + 1) - begin,
+            destination, count[chunk].data(), pass, key);
+      });
+      return true;
+    };
+
+    // Indica si los datos ordenados hasta ahora están en el buffer.
+    bool in_buffer = false;
+    for (int pass = 0; pass < passes; ++pass) {
+      if (in_buffer ? distribute(buffer, Arr, pass)
+          : distribute(Arr, buffer, pass)) {
+        in_buffer = !in_buffer;
+      }
+    }
+
+    // Si el resultado quedó en el buffer, moverlo al arreglo original.
+    if (in_buffer) {
+      Counter::move(n);
+      pool.parallelFor(0, chunks, [&](const std::size_t chunk) {
+        std::move(buffer + chunkBegin(chunk), buffer + chunkBegin(chunk + 1),
+            Arr + chunkBegin(chunk));
+      });
+    }
+  }
+
+  /**
+   * @brief Calcula la permutación que ordena el arreglo según su llave, con
+   * el Radix Sort LSD sobre pares (llave, índice).
+   *
+   * Si la llave es de hasta 4 bytes, cada par se empaca en una palabra de 64
+   * bits, con la llave en la parte alta y el índice en la baja, de modo que
+   * las pasadas mueven 8 bytes por elemento en lugar de leer el arreglo
+   * original en un orden aleatorio. Solo se hacen las pasadas de los bytes
+   * de la llave: los pares empiezan ordenados por índice y el Radix Sort LSD
+   * es estable, por lo que los empates quedan en su orden original.
+   *
+   * @param Arr Arreglo a revisar, no se modifica.
+   * @param n Tamaño del arreglo.
+   * @param key Extractor de la llave numérica de cada elemento.
+   * @return std::vector<int> Índices de los elementos en orden.
+   */
+  template <typename RandomIt, typename KeyFn>
+  std::vector<int> radixArgsort(RandomIt Arr, const int n, KeyFn key) const {
+    using Bits = decltype(Self::radixKey(key(Arr[0])));
+    std::vector<int> permutation(n);
+    if constexpr (sizeof(Bits) <= 4) {
+      std::vector<uint64_t> packed(n);
+      Counter::allocation(sizeof(uint64_t) * n);
+      for (int i = 0; i < n; ++i) {
+        packed[i] = uint64_t(Self::radixKey(key(Arr[i]))) << 32
+            | static_cast<uint32_t>(i);
+      }
+      this->byteRadixSort(packed.begin(), n, [](const uint64_t word) {
+        return static_cast<Bits>(word >> 32);
+      });
+      for (int i = 0; i < n; ++i) {
+        permutation[i] = static_cast<int>(static_cast<uint32_t>(packed[i]));
+      }
+    } else {
+      // Las llaves de 8 bytes no caben junto al índice en una palabra.
+      std::vector<std::pair<Bits, int>> pairs(n);
+      Counter::allocation(sizeof(std::pair<Bits, int>) * n);
+      for (int i = 0; i < n; ++i) {
+        pairs[i] = {Self::radixKey(key(Arr[i])), i};
+      }
+      this->byteRadixSort(pairs.begin(), n,
+          [](const std::pair<Bits, int>& pair) { return pair.first; });
+      for (int i = 0; i < n; ++i) {
+        permutation[i] = pairs[i].second;
+      }
+    }
+    Counter::move(2 * uint64_t(n));
+    return permutation;
+  }
+
+  /**
+   * @brief Arma el árbol de búsqueda implícito de los separadores del Sample
+   * Sort. tree[1] es la raíz y los hijos de tree[node] son tree[2 * node] y
+   * tree[2 * node + 1], de modo que un recorrido en orden da los separadores
+   * ordenados.
+   *
+   * @param splitters Separadores ordenados.
+   * @param tree Salida: árbol, tree[0] no se usa.
+   * @param node Raíz del sub-árbol.
+   * @param first Primer separador del sub-árbol.
+   * @param last Índice siguiente al último separador del sub-árbol.
+   */
+  template <typename T>
+  static void buildSplitterTree(const std::vector<T>& splitters,
+      std::vector<T>& tree, const std::size_t node, const std::size_t first,
+      const std::size_t last) {
+    if (first >= last) { return; }
+    const std::size_t mid = first + (last - first) / 2;
+    tree[node] = splitters[mid];
+    Self::buildSplitterTree(splitters, tree, 2 * node, first, mid);
+    Self::buildSplitterTree(splitters, tree, 2 * node + 1, mid + 1,
+        last);
+  }
+
+  /**
+   * @brief Busca la cubeta de un elemento en el árbol de separadores.
+   *
+   * Baja un nivel por comparación sumando el resultado de la comparación al
+   * índice del nodo, sin saltos difíciles de predecir. La cubeta i tiene los
+   * elementos mayores que el separador i - 1 y menores o iguales al
+   * separador i.
+   *
+   * @param tree Árbol de separadores.
+   * @param value Elemento a clasificar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @return unsigned int Índice de la cubeta.
+   */
+  template <typename T, typename Compare>
+  static inline unsigned int classifySample(const T* tree, const T& value,
+      Compare& comp) {
+    unsigned int node = 1;
+    for (int level = 0; level < Self::sample_log_buckets; ++level) {
+      node = 2 * node + static_cast<unsigned int>(comp(tree[node], value));
+    }
+    return node - Self::sample_buckets;
+  }
+
+  /**
+   * @brief Sample Sort paralelo.
+   *
+   * Toma una muestra aleatoria del arreglo, la ordena y elige de ella
+   * sample_buckets - 1 separadores. Cada hilo clasifica un bloque del
+   * arreglo con classifySample() y cuenta un histograma local; una suma de
+   * prefijos sobre los histogramas define dónde escribe cada hilo cada
+   * cubeta, y los hilos distribuyen sus bloques en buffer en paralelo.
+   * Luego ordena las cubetas en paralelo con Introsort, o con el Quick Sort
+   * de tres vías si la muestra tiene separadores repetidos, y las mueve de
+   * vuelta al arreglo.
+   *
+   * @param pool Pool de hilos que ejecuta las tareas.
+   * @param Arr Arreglo a ordenar.
+   * @param buffer Arreglo auxiliar de n elementos.
+   * @param n Tamaño del arreglo.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename BufferIt, typename Compare>
+  void parallelSampleSort(WorkStealingPool& pool, RandomIt Arr,
+      BufferIt buffer, const int n, Compare comp) const {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    constexpr int buckets = Self::sample_buckets;
+    if (n <= Self::sample_sort_cutoff) {
+      this->introSort(Arr, 0, n - 1, Self::introDepthLimit(n), comp);
+      return;
+    }
+
+    // Muestra aleatoria, con una semilla fija para que el resultado sea
+    // reproducible.
+    std::minstd_rand generator(static_cast<unsigned int>(n));
+    std::uniform_int_distribution<int> position(0, n - 1);
+    std::vector<T> sample;
+    sample.reserve(buckets * Self::sample_oversampling);
+    for (int i = 0; i < buckets * Self::sample_oversampling; ++i) {
+      sample.push_back(Arr[position(generator)]);
+    }
+    Counter::allocation(sizeof(T) * sample.size());
+    Counter::move(sample.size());
+    const int sample_len = static_cast<int>(sample.size());
+    this->introSort(sample.begin(), 0, sample_len - 1,
+        Self::introDepthLimit(sample_len), comp);
+
+    std::vector<T> splitters;
+    splitters.reserve(buckets - 1);
+    bool duplicates = false;
+    for (int i = 1; i < buckets; ++i) {
+      splitters.push_back(sample[i * Self::sample_oversampling]);
+      duplicates = duplicates || (i > 1
+          && !comp(splitters[i - 2], splitters[i - 1]));
+    }
+    std::vector<T> tree(buckets, splitters.front());
+    Self::buildSplitterTree(splitters, tree, 1, 0, splitters.size());
+
+    // Clasificar cada bloque, guardando la cubeta de cada elemento.
+    const int chunks = static_cast<int>(pool.size());
+    const int chunk_len = (n + chunks - 1) / chunks;
+    std::vector<std::uint8_t> oracle(n);
+    std::vector<std::array<int, buckets>> count(chunks);
+    pool.parallelFor(0, chunks, [&](const std::size_t chunk) {
+      const int begin = static_cast<int>(chunk) * chunk_len;
+      const int end = std::min(n, begin + chunk_len);
+      Compare local_comp = comp;
+      for (int i = begin; i < end; ++i) {
+        const unsigned int bucket = Self::classifySample(tree.data(),
+            Arr[i], local_comp);
+        oracle[i] = static_cast<std::uint8_t>(bucket);
+        ++count[chunk][bucket];
+      }
+    });
+
+    // Posición inicial de cada cubeta y, dentro de ella, de cada bloque.
+    int start[buckets + 1] = {};
+    for (int bucket = 0; bucket < buckets; ++bucket) {
+      int offset = start[bucket];
+      for (int chunk = 0; chunk < chunks; ++chunk) {
+        const int chunk_count = count[chunk][bucket];
+        count[chunk][bucket] = offset;
+        offset += chunk_count;
+      }
+      start[bucket + 1] = offset;
+    }
+
+    // Distribuir cada bloque en paralelo.
+    Counter::move(n);
+    pool.parallelFor(0, chunks, [&](const std::size_t chunk) {
+      const int begin = static_cast<int>(chunk) * chunk_len;
+      const int end = std::min(n, begin + chunk_len);
+      for (int i = begin; i < end; ++i) {
+        buffer[count[chunk][oracle[i]]++] = std::move(Arr[i]);
+      }
+    });
+
+    // Ordenar las cubetas en paralelo y moverlas de vuelta.
+    Counter::move(n);
+    pool.parallelFor(0, buckets, [&](const std::size_t bucket) {
+      const int first = start[bucket];
+      const int length = start[bucket + 1] - first;
+      if (length == 0) { return; }
+      if (duplicates) {
+        this->threeWayQuickSort(buffer + first, 0, length - 1,
+            Self::introDepthLimit(length), comp);
+      } else {
+        this->introSort(buffer + first, 0, length - 1,
+            Self::introDepthLimit(length), comp);
+      }
+      std::move(buffer + first, buffer + first + length, Arr + first);
+    });
+  }
+
+ public:
+  BasicOrdenador() = default;
+  ~BasicOrdenador() = default;
+
+  BasicOrdenador(BasicOrdenador& o) = delete;
+  BasicOrdenador(BasicOrdenador&& o) = delete;
+  BasicOrdenador& operator=(BasicOrdenador& o) = delete;
+  BasicOrdenador& operator=(BasicOrdenador&& o) = delete;
+
+  /* Nota:
+    - Si no planea implementar algunos de los métodos de ordenamiento, no los
+      borre.
+    - Simplemente déjelos con el cuerpo vacío para evitar errores de
+      compilación, ya que se ejecutará el mismo main para todas las tareas.
+    - Recuerde hacer uso de programación defensiva y documentar los métodos
+      con formato Doxygen, por ejemplo.
+    - No cambié la firma de los métodos de la clase Ordenador.
+    - No lance excepciones para el manejo de errores.
+      Ante un error, basta con que el método no modifique el arreglo original
+      y que no cause la caída del programa.
+  */
+
+  /**
+   * @brief Implementación del Selection Sort.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   */
+  void ordenamientoPorSeleccion(int *A, int n) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    Self::selectionSort(A, n, Self::counted(std::less<>()));
+  }
+
+  /**
+   * @brief Implementación genérica del Selection Sort.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorSeleccion(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    Self::selectionSort(first, n, Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del Insertion Sort.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   */
+  void ordenamientoPorInsercion(int *A, int n) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    Self::insertionSort(A, 0, n - 1, Self::counted(std::less<>()));
+  }
+
+  /**
+   * @brief Implementación genérica del Insertion Sort.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorInsercion(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    Self::insertionSort(first, 0, n - 1, Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del Insertion Sort binario.
+   *
+   * Busca la posición de cada elemento con búsqueda binaria, lo que reduce
+   * las comparaciones a O(n log n), y desplaza el bloque de elementos mayores
+   * de una sola vez (memmove para tipos triviales). Es estable.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   */
+  void ordenamientoPorInsercionBinaria(int *A, int n) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    Self::binaryInsertionSort(A, 0, n, 1,
+        Self::counted(std::less<>()));
+  }
+
+  /**
+   * @brief Implementación genérica del Insertion Sort binario.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorInsercionBinaria(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    Self::binaryInsertionSort(first, 0, n, 1, Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del Insertion Sort con centinela.
+   *
+   * Coloca el menor elemento al inicio para que el ciclo interno no tenga
+   * que revisar el límite del arreglo. Es estable.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   */
+  void ordenamientoPorInsercionCentinela(int *A, int n) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    Self::sentinelInsertionSort(A, 0, n - 1,
+        Self::counted(std::less<>()));
+  }
+
+  /**
+   * @brief Implementación genérica del Insertion Sort con centinela.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorInsercionCentinela(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    Self::sentinelInsertionSort(first, 0, n - 1, Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del Merge Sort.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   */
+  void ordenamientoPorMezcla(int *A, int n) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    this->mergeSort(A, 0, n - 1, Self::counted(std::less<>()));
+  }
+
+  /**
+   * @brief Implementación genérica del Merge Sort. Es estable.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorMezcla(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    this->mergeSort(first, 0, n - 1, Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del Merge Sort con un único buffer auxiliar.
+   *
+   * A diferencia de ordenamientoPorMezcla(), no reserva memoria en cada
+   * mezcla: usa un solo buffer de n elementos y alterna entre este y el
+   * arreglo en cada nivel, sin copiar de vuelta.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   * @param buffer Buffer auxiliar de al menos n elementos provisto por quien
+   * llama, o nullptr para que el método reserve uno propio.
+   */
+  void ordenamientoPorMezclaConBuffer(int *A, int n,
+      int *buffer = nullptr) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    this->ordenamientoPorMezclaConBuffer(A, A + n, std::less<>(), buffer);
+  }
+
+  /**
+   * @brief Implementación genérica del Merge Sort con un único buffer
+   * auxiliar.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @param buffer Buffer auxiliar de al menos last - first elementos provisto
+   * por quien llama, o nullptr para que el método reserve uno propio.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorMezclaConBuffer(RandomIt first, RandomIt last,
+      Compare comp = Compare(),
+      typename std::iterator_traits<RandomIt>::value_type* buffer = nullptr)
+      const {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    Counter::move(n);
+    if (buffer != nullptr) {
+      std::copy(first, last, buffer);
+      this->pingPongMergeSort(buffer, first, 0, n - 1,
+          Self::counted(comp));
+    } else {
+      std::vector<T> scratch(first, last);
+      Counter::allocation(sizeof(T) * n);
+      this->pingPongMergeSort(scratch.begin(), first, 0, n - 1,
+          Self::counted(comp));
+    }
+  }
+
+  /**
+   * @brief Implementación paralela del Merge Sort.
+   *
+   * Divide la recursión entre los hilos de un pool con robo de trabajo y
+   * también mezcla en paralelo. El resultado es idéntico al de
+   * ordenamientoPorMezcla().
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   * @param threads Cantidad de hilos a usar, 0 para usar todos los núcleos.
+   */
+  void ordenamientoPorMezclaParalelo(int *A, int n, int threads = 0) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    this->ordenamientoPorMezclaParalelo(A, A + n, std::less<>(), threads);
+  }
+
+  /**
+   * @brief Implementación genérica y paralela del Merge Sort. Es estable.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @param threads Cantidad de hilos a usar, 0 para usar todos los núcleos.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorMezclaParalelo(RandomIt first, RandomIt last,
+      Compare comp = Compare(), int threads = 0) const {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+    if (threads < 0) {
+      std::cerr << "La cantidad de hilos no es válida." << std::endl;
+      return;
+    }
+
+    WorkStealingPool pool(threads);
+    ScratchBuffer<T> buffer(first, n);
+    pool.run([&] {
+      // El Merge Sort con ping-pong necesita una copia del arreglo.
+      if constexpr (ScratchBuffer<T>::uninitialized) {
+        Self::parallelCopy(pool, first, n, buffer.data());
+      }
+      this->parallelMergeSort(pool, buffer.data(), first, 0, n - 1,
+          Self::counted(comp));
+    });
+  }
+
+  /**
+   * @brief Implementación del Merge Sort adaptativo (natural), al estilo de
+   * TimSort.
+   *
+   * Aprovecha las corridas ya ordenadas o invertidas del arreglo, alarga las
+   * cortas con Insertion Sort binario y las mezcla con galope, por lo que
+   * los arreglos casi ordenados toman cerca de O(n). Es estable.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   */
+  void ordenamientoPorMezclaAdaptativo(int *A, int n) const {
+    if (!this->validateArray(A, n)) { return; }
 
-    for (int i = 1; i < 10; ++i) {
-      // Sumar las apariciones de los dígitos anteriores.
-      // Esto indica la posición de cada dígito en el arreglo ordenado.
-      count[i] += count[i - 1];
-    }
+    Self::timSort(A, n, Self::counted(std::less<>()));
+  }
 
-    // Recorrer el arreglo en orden inverso,
-    // para conservar el orden de los elementos.
-    for (int i = n - 1; i >= 0; --i) {
-      // Agregar los elementos a "B" en la posición indicada por "C".
-      output[count[getDigit(Arr, i, digits)] - 1] = Arr[i];
-      // Disminuir la posición del siguiente elemento del mismo dígito.
-      count[getDigit(Arr, i, digits)]--;
-    }
+  /**
+   * @brief Implementación genérica del Merge Sort adaptativo.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorMezclaAdaptativo(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
 
-    for (int i = 0; i < n; ++i) {
-      // Copiar los elementos ordenados al arreglo original.
-      Arr[i] = output[i];
-    }
+    Self::timSort(first, n, Self::counted(comp));
   }
 
   /**
-   * @brief Sección principal del Radix Sort.
+   * @brief Implementación del Heap Sort.
    *
-   * @param Arr Arreglo a ordenar.
+   * @param A Arreglo a ordenar.
    * @param n Tamaño del arreglo.
    */
-  void radixSort(int* Arr, const int n) const {
-    // Encontrar el valor máximo en el arreglo (k).
-    int max = this->getMax(Arr, n);
+  void ordenamientoPorMonticulos(int *A, int n) const {
+    if (!this->validateArray(A, n)) { return; }
 
-    // Ordenar los elementos por dígito.
-    for (int digits = 1; max / digits > 0; digits *= 10) {
-      this->countingSort(Arr, n, digits);
-    }
+    this->heapSort(A, n, Self::counted(std::less<>()));
   }
 
   /**
-   * @brief Obtiene el dígito de un número en una posición específica.
+   * @brief Implementación genérica del Heap Sort.
    *
-   * @param Arr Arreglo a revisar.
-   * @param i Índice del elemento en el arreglo.
-   * @param digits Dígitos a considerar.
-   * @return int Dígito en la posición indicada.
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
    */
-  int getDigit(int *Arr, int i, const int digits) const {
-    return (Arr[i] / digits) % 10;
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorMonticulos(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    this->heapSort(first, n, Self::counted(comp));
   }
 
- public:
-  Ordenador() = default;
-  ~Ordenador() = default;
+  /**
+   * @brief Implementación del Heap Sort iterativo con el método de Floyd.
+   *
+   * Baja cada elemento hasta una hoja siguiendo al hijo mayor y luego lo
+   * sube hasta su posición, por lo que hace menos comparaciones que
+   * ordenamientoPorMonticulos() y no usa recursión.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   */
+  void ordenamientoPorMonticulosFloyd(int *A, int n) const {
+    if (!this->validateArray(A, n)) { return; }
 
-  Ordenador(Ordenador& o) = delete;
-  Ordenador(Ordenador&& o) = delete;
-  Ordenador& operator=(Ordenador& o) = delete;
-  Ordenador& operator=(Ordenador&& o) = delete;
+    Self::floydHeapSort<2>(A, n, Self::counted(std::less<>()));
+  }
 
-  /* Nota:
-    - Si no planea implementar algunos de los métodos de ordenamiento, no los
-      borre.
-    - Simplemente déjelos con el cuerpo vacío para evitar errores de
-      compilación, ya que se ejecutará el mismo main para todas las tareas.
-    - Recuerde hacer uso de programación defensiva y documentar los métodos
-      con formato Doxygen, por ejemplo.
-    - No cambié la firma de los métodos de la clase Ordenador.
-    - No lance excepciones para el manejo de errores.
-      Ante un error, basta con que el método no modifique el arreglo original
-      y que no cause la caída del programa.
-  */
+  /**
+   * @brief Implementación genérica del Heap Sort con el método de Floyd.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorMonticulosFloyd(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    Self::floydHeapSort<2>(first, n, Self::counted(comp));
+  }
 
   /**
-   * @brief Implementación del Selection Sort.
+   * @brief Implementación del Heap Sort con un montículo cuaternario.
+   *
+   * Usa el método de Floyd con 4 hijos por nodo. El montículo tiene la mitad
+   * de niveles que uno binario y los hijos de un nodo suelen estar en la
+   * misma línea de caché, lo que reduce los fallos de caché en arreglos
+   * grandes.
    *
    * @param A Arreglo a ordenar.
    * @param n Tamaño del arreglo.
    */
-  void ordenamientoPorSeleccion(int *A, int n) const {
+  void ordenamientoPorMonticulosCuaternario(int *A, int n) const {
     if (!this->validateArray(A, n)) { return; }
 
-    for (int i = 0; i < n - 1; ++i) {
-      // Seleccionar el elemento más pequeño en A[i:n]
-      int min = i;
-      for (int j = i + 1; j < n; ++j) {
-        if (A[j] < A[min]) {
-          // Guardar el índice en m.
-          min = j;
-        }
-      }
-      // Intercambiar A[i] con el A[min] resultante.
-      if (min != i) {
-        Ordenador::swap(A[min], A[i]);
-      }
-    }
+    Self::floydHeapSort<4>(A, n, Self::counted(std::less<>()));
   }
 
   /**
-   * @brief Implementación del Insertion Sort.
+   * @brief Implementación genérica del Heap Sort con un montículo
+   * cuaternario.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorMonticulosCuaternario(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    Self::floydHeapSort<4>(first, n, Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del Quick Sort.
    *
    * @param A Arreglo a ordenar.
    * @param n Tamaño del arreglo.
    */
-  void ordenamientoPorInsercion(int *A, int n) const {
+  void ordenamientoRapido(int *A, int n) const {
     if (!this->validateArray(A, n)) { return; }
 
-    for (int i = 1; i < n; ++i) {
-      int key = A[i];
-      // Insertar A[i] en el sub-arreglo ordenado A[0:i-1]
-      int j = i - 1;
-      while (j >= 0 && A[j] > key) {
-        A[j + 1] = A[j];
-        j = j - 1;
-      }
-      // Insertar key.
-      A[j + 1] = key;
-    }
+    this->quickSort(A, 0, n - 1, Self::counted(std::less<>()));
   }
 
   /**
-   * @brief Implementación del Merge Sort.
+   * @brief Implementación genérica del Quick Sort.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoRapido(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    this->quickSort(first, 0, n - 1, Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del Introsort, un Quick Sort híbrido.
+   *
+   * Elige el pivote con mediana de tres o de nueve, ordena por inserción los
+   * rangos pequeños y cambia a Heap Sort si la profundidad supera
+   * 2 * log2(n), por lo que mantiene O(n log n) incluso con arreglos
+   * ordenados o invertidos.
    *
    * @param A Arreglo a ordenar.
    * @param n Tamaño del arreglo.
    */
-  void ordenamientoPorMezcla(int *A, int n) const {
+  void ordenamientoRapidoIntrospectivo(int *A, int n) const {
     if (!this->validateArray(A, n)) { return; }
 
-    this->mergeSort(A, 0, n - 1);
+    this->introSort(A, 0, n - 1, Self::introDepthLimit(n),
+        Self::counted(std::less<>()));
   }
 
   /**
-   * @brief Implementación del Heap Sort.
+   * @brief Implementación genérica del Introsort.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoRapidoIntrospectivo(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    this->introSort(first, 0, n - 1, Self::introDepthLimit(n),
+        Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del Quick Sort con partición de tres vías.
+   *
+   * Agrupa los elementos iguales al pivote en una sola pasada, lo que evita
+   * el comportamiento cuadrático con arreglos de pocos valores distintos.
    *
    * @param A Arreglo a ordenar.
    * @param n Tamaño del arreglo.
    */
-  void ordenamientoPorMonticulos(int *A, int n) const {
+  void ordenamientoRapidoTresVias(int *A, int n) const {
     if (!this->validateArray(A, n)) { return; }
 
-    int heap_size = n;
-    this->buildMaxHeap(A, n, heap_size);
-    for (int i = n - 1; i >= 0; --i) {
-      Ordenador::swap(A[0], A[i]);
-      --heap_size;
-      this->maxHeapify(A, 0, heap_size);
-    }
+    this->threeWayQuickSort(A, 0, n - 1, Self::introDepthLimit(n),
+        Self::counted(std::less<>()));
   }
 
   /**
-   * @brief Implementación del Quick Sort.
+   * @brief Implementación genérica del Quick Sort con partición de tres vías.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoRapidoTresVias(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    this->threeWayQuickSort(first, 0, n - 1, Self::introDepthLimit(n),
+        Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del Quick Sort vectorizado con AVX2.
+   *
+   * Particiona 8 elementos a la vez con instrucciones vectoriales y una
+   * tabla de permutaciones, y ordena los rangos de hasta 64 elementos con
+   * redes de ordenamiento, por lo que los ciclos internos casi no tienen
+   * saltos que dependan de los datos. Mantiene el límite de profundidad del
+   * Introsort. Si el procesador no soporta AVX2, usa
+   * ordenamientoRapidoIntrospectivo().
    *
    * @param A Arreglo a ordenar.
    * @param n Tamaño del arreglo.
    */
-  void ordenamientoRapido(int *A, int n) const {
+  void ordenamientoRapidoVectorizado(int *A, int n) const {
     if (!this->validateArray(A, n)) { return; }
 
-    this->quickSort(A, 0, n - 1);
+#if SIMD_SORT_AVX2
+    if (SimdSort::available()) {
+      this->vectorizedQuickSort(A, 0, n - 1, Self::introDepthLimit(n),
+          /* leftmost */ true);
+      return;
+    }
+#endif
+    this->introSort(A, 0, n - 1, Self::introDepthLimit(n),
+        Self::counted(std::less<>()));
   }
 
   /**
    * @brief Implementación del Radix Sort.
    *
+   * Usa dígitos decimales, por lo que solo está disponible para int. Para
+   * otros tipos use ordenamientoPorRadixBytes().
+   *
    * @param A Arreglo a ordenar.
    * @param n Tamaño del arreglo.
    */
@@ -424,6 +2868,369 @@ class Ordenador {
     this->radixSort(A, n);
   }
 
+  /**
+   * @brief Implementación del Radix Sort LSD en base 256.
+   *
+   * Ordena por bytes en lugar de por dígitos decimales, por lo que necesita a
+   * lo sumo 4 pasadas, y soporta números negativos.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   */
+  void ordenamientoPorRadixBytes(int *A, int n) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    this->byteRadixSort(A, n, IdentityKey());
+  }
+
+  /**
+   * @brief Implementación genérica del Radix Sort LSD en base 256. Es
+   * estable.
+   *
+   * La llave puede ser cualquier tipo entero o de punto flotante de hasta
+   * 8 bytes. Se hace una pasada por cada byte de la llave.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param key Extractor de la llave numérica de cada elemento. Por omisión
+   * se usa el mismo elemento.
+   */
+  template <typename RandomIt, typename KeyFn = IdentityKey>
+  void ordenamientoPorRadixBytes(RandomIt first, RandomIt last,
+      KeyFn key = KeyFn()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+
+    this->byteRadixSort(first, n, key);
+  }
+
+  /**
+   * @brief Implementación paralela del Radix Sort MSD en base 256.
+   *
+   * Cada hilo cuenta un histograma de su parte del arreglo, se distribuyen
+   * los elementos en paralelo y luego cada cubeta se ordena en paralelo,
+   * con Insertion Sort para las cubetas pequeñas. Soporta números negativos.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   * @param threads Cantidad de hilos a usar, 0 para usar todos los núcleos.
+   */
+  void ordenamientoPorRadixParalelo(int *A, int n, int threads = 0) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    this->ordenamientoPorRadixParalelo(A, A + n, IdentityKey(), threads);
+  }
+
+  /**
+   * @brief Implementación genérica y paralela del Radix Sort MSD en base 256.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param key Extractor de la llave numérica de cada elemento.
+   * @param threads Cantidad de hilos a usar, 0 para usar todos los núcleos.
+   */
+  template <typename RandomIt, typename KeyFn = IdentityKey>
+  void ordenamientoPorRadixParalelo(RandomIt first, RandomIt last,
+      KeyFn key = KeyFn(), int threads = 0) const {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+    if (threads < 0) {
+      std::cerr << "La cantidad de hilos no es válida." << std::endl;
+      return;
+    }
+
+    WorkStealingPool pool(threads);
+    ScratchBuffer<T> buffer(first, n);
+    pool.run([&] {
+      this->parallelMsdRadixSort(pool, first, buffer.data(), n,
+          Self::radixTopPass<RandomIt, KeyFn>(),
+          /* result_in_source */ true, key);
+    });
+  }
+
+  /**
+   * @brief Implementación paralela y estable del Radix Sort LSD en base 256.
+   *
+   * Cada pasada cuenta histogramas por bloque y distribuye los bloques en
+   * paralelo, conservando el orden de los elementos con el mismo byte. Al
+   * ser estable, el resultado es idéntico con cualquier cantidad de hilos.
+   * Soporta números negativos.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   * @param threads Cantidad de hilos a usar, 0 para usar todos los núcleos.
+   */
+  void ordenamientoPorRadixEstableParalelo(int *A, int n, int threads = 0)
+      const {
+    if (!this->validateArray(A, n)) { return; }
+
+    this->ordenamientoPorRadixEstableParalelo(A, A + n, IdentityKey(),
+        threads);
+  }
+
+  /**
+   * @brief Implementación genérica, paralela y estable del Radix Sort LSD en
+   * base 256.
+   *
+   * Sirve para ordenar registros por varias llaves en pasadas sucesivas,
+   * empezando por la llave menos importante: cada pasada conserva el orden
+   * de las anteriores entre los registros con la misma llave.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param key Extractor de la llave numérica de cada elemento, de hasta 8
+   * bytes.
+   * @param threads Cantidad de hilos a usar, 0 para usar todos los núcleos.
+   */
+  template <typename RandomIt, typename KeyFn = IdentityKey>
+  void ordenamientoPorRadixEstableParalelo(RandomIt first, RandomIt last,
+      KeyFn key = KeyFn(), int threads = 0) const {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+    if (threads < 0) {
+      std::cerr << "La cantidad de hilos no es válida." << std::endl;
+      return;
+    }
+
+    WorkStealingPool pool(threads);
+    ScratchBuffer<T> buffer(first, n);
+    pool.run([&] {
+      this->parallelLsdRadixSort(pool, first, buffer.data(), n, key);
+    });
+  }
+
+  /**
+   * @brief Implementación paralela del Sample Sort.
+   *
+   * Reparte los elementos en 256 cubetas según separadores tomados de una
+   * muestra, clasificando y distribuyendo en paralelo, y luego ordena las
+   * cubetas en paralelo. Usa un buffer auxiliar de n elementos. No es
+   * estable.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo.
+   * @param threads Cantidad de hilos a usar, 0 para usar todos los núcleos.
+   */
+  void ordenamientoPorMuestreoParalelo(int *A, int n, int threads = 0) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    this->ordenamientoPorMuestreoParalelo(A, A + n, std::less<>(), threads);
+  }
+
+  /**
+   * @brief Implementación genérica y paralela del Sample Sort.
+   *
+   * @param first Inicio del rango a ordenar.
+   * @param last Fin del rango a ordenar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @param threads Cantidad de hilos a usar, 0 para usar todos los núcleos.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoPorMuestreoParalelo(RandomIt first, RandomIt last,
+      Compare comp = Compare(), int threads = 0) const {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+    if (threads < 0) {
+      std::cerr << "La cantidad de hilos no es válida." << std::endl;
+      return;
+    }
+
+    WorkStealingPool pool(threads);
+    ScratchBuffer<T> buffer(first, n);
+    pool.run([&] {
+      this->parallelSampleSort(pool, first, buffer.data(), n,
+          Self::counted(comp));
+    });
+  }
+
+  /**
+   * @brief Selecciona el k-ésimo elemento del arreglo con Introselect.
+   *
+   * Al terminar A[k] es el elemento que estaría en esa posición si el
+   * arreglo estuviera ordenado, los anteriores son menores o iguales y los
+   * siguientes mayores o iguales. Toma O(n) en promedio, en lugar del
+   * O(n log n) de ordenar todo el arreglo.
+   *
+   * @param A Arreglo a revisar.
+   * @param n Tamaño del arreglo.
+   * @param k Posición a seleccionar, 0 <= k < n.
+   */
+  void seleccionarEnesimo(int *A, int n, int k) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    this->seleccionarEnesimo(A, A + n, k);
+  }
+
+  /**
+   * @brief Implementación genérica de la selección del k-ésimo elemento.
+   *
+   * @param first Inicio del rango a revisar.
+   * @param last Fin del rango a revisar.
+   * @param k Posición a seleccionar, 0 <= k < last - first.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void seleccionarEnesimo(RandomIt first, RandomIt last, int k,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+    if (k < 0 || k >= n) {
+      std::cerr << "La posición a seleccionar no es válida." << std::endl;
+      return;
+    }
+
+    Self::introSelect(first, 0, n - 1, k, Self::introDepthLimit(n),
+        Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del ordenamiento parcial (top-k).
+   *
+   * Deja en A[0:k-1], ordenados, los k menores elementos del arreglo, con un
+   * montículo acotado a k elementos. Toma O(n log k), y sin memoria
+   * adicional. El resto del arreglo queda en un orden indefinido.
+   *
+   * @param A Arreglo a ordenar parcialmente.
+   * @param n Tamaño del arreglo.
+   * @param k Cantidad de elementos a ordenar, 1 <= k <= n.
+   */
+  void ordenamientoParcial(int *A, int n, int k) const {
+    if (!this->validateArray(A, n)) { return; }
+
+    this->ordenamientoParcial(A, A + n, k);
+  }
+
+  /**
+   * @brief Implementación genérica del ordenamiento parcial (top-k). Con
+   * std::greater selecciona los k mayores.
+   *
+   * @param first Inicio del rango a ordenar parcialmente.
+   * @param last Fin del rango a ordenar parcialmente.
+   * @param k Cantidad de elementos a ordenar, 1 <= k <= last - first.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  void ordenamientoParcial(RandomIt first, RandomIt last, int k,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+    if (k < 1 || k > n) {
+      std::cerr << "La cantidad de elementos a ordenar no es válida."
+                << std::endl;
+      return;
+    }
+
+    Self::partialHeapSort(first, n, k, Self::counted(comp));
+  }
+
+  /**
+   * @brief Implementación del ordenamiento indirecto (argsort).
+   *
+   * Retorna la permutación que ordena el arreglo, sin modificarlo: A[p[0]],
+   * A[p[1]], ... quedan en orden. Usa el Radix Sort sobre pares (llave,
+   * índice) empacados en 64 bits y es estable.
+   *
+   * @param A Arreglo a revisar, no se modifica.
+   * @param n Tamaño del arreglo.
+   * @return std::vector<int> Índices de los elementos en orden, o un vector
+   * vacío si el arreglo no es válido.
+   */
+  std::vector<int> ordenamientoIndirecto(const int *A, int n) const {
+    if (!this->validateArray(A, n)) { return {}; }
+
+    return this->ordenamientoIndirectoRadix(A, A + n);
+  }
+
+  /**
+   * @brief Implementación genérica del ordenamiento indirecto (argsort) con
+   * un comparador. Es estable.
+   *
+   * Ordena los índices con el Merge Sort adaptativo, comparando los
+   * elementos a los que apuntan, por lo que los elementos nunca se mueven.
+   *
+   * @param first Inicio del rango a revisar.
+   * @param last Fin del rango a revisar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   * @return std::vector<int> Índices de los elementos en orden, o un vector
+   * vacío si el rango no es válido.
+   */
+  template <typename RandomIt, typename Compare = std::less<>>
+  std::vector<int> ordenamientoIndirecto(RandomIt first, RandomIt last,
+      Compare comp = Compare()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return {}; }
+
+    std::vector<int> permutation(n);
+    Counter::allocation(sizeof(int) * n);
+    for (int i = 0; i < n; ++i) {
+      permutation[i] = i;
+    }
+    auto counted_comp = Self::counted(comp);
+    Self::timSort(permutation.begin(), n,
+        [&first, &counted_comp](const int a, const int b) {
+          return counted_comp(first[a], first[b]);
+        });
+    return permutation;
+  }
+
+  /**
+   * @brief Implementación genérica del ordenamiento indirecto (argsort) con
+   * el Radix Sort sobre pares (llave, índice). Es estable.
+   *
+   * La llave puede ser cualquier tipo entero o de punto flotante de hasta
+   * 8 bytes. Con llaves de hasta 4 bytes cada par se empaca en 64 bits.
+   *
+   * @param first Inicio del rango a revisar.
+   * @param last Fin del rango a revisar.
+   * @param key Extractor de la llave numérica de cada elemento. Por omisión
+   * se usa el mismo elemento.
+   * @return std::vector<int> Índices de los elementos en orden, o un vector
+   * vacío si el rango no es válido.
+   */
+  template <typename RandomIt, typename KeyFn = IdentityKey>
+  std::vector<int> ordenamientoIndirectoRadix(RandomIt first, RandomIt last,
+      KeyFn key = KeyFn()) const {
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return {}; }
+
+    return this->radixArgsort(first, n, key);
+  }
+
+  /**
+   * @brief Reordena un rango según una permutación calculada con
+   * ordenamientoIndirecto(), de modo que el elemento i pasa a ser el
+   * elemento permutation[i] original.
+   *
+   * Sirve para aplicar la misma permutación a varias columnas de datos,
+   * moviendo cada elemento una sola vez. Usa un buffer de n elementos.
+   *
+   * @param first Inicio del rango a reordenar.
+   * @param last Fin del rango a reordenar.
+   * @param permutation Permutación de los índices 0 a n - 1.
+   */
+  template <typename RandomIt>
+  void aplicarPermutacion(RandomIt first, RandomIt last,
+      const std::vector<int>& permutation) const {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    int n = 0;
+    if (!this->validateRange(first, last, n)) { return; }
+    if (permutation.size() != static_cast<std::size_t>(n)) {
+      std::cerr << "La permutación no es válida." << std::endl;
+      return;
+    }
+
+    std::vector<T> buffer(std::make_move_iterator(first),
+        std::make_move_iterator(last));
+    Counter::allocation(sizeof(T) * n);
+    for (int i = 0; i < n; ++i) {
+      first[i] = std::move(buffer[permutation[i]]);
+    }
+    Counter::move(2 * uint64_t(n));
+  }
+
   /**
    * @brief Retorna un std::string con los datos de la tarea.
    *
@@ -436,3 +3243,6 @@ class Ordenador {
     return "Carné: C35280, Nombre: José Manuel Mora Z, Tarea 1 Etapa 2";
   }
 };
+
+/// Algoritmos de ordenamiento sin conteo de operaciones.
+using Ordenador = BasicOrdenador<>;
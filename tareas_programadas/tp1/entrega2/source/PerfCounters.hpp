@@ -0,0 +1,239 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <array>
+#include <cstdint>
+#include <limits>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+/**
+ * @brief Contadores de rendimiento (ciclos, instrucciones, fallos de
+ * predicción, de caché y de página) del hilo actual y de los hilos que este
+ * cree, leídos con perf_event_open de Linux.
+ *
+ * Cada contador se abre por separado, de modo que si el procesador o el
+ * sistema no permite alguno (por ejemplo en una máquina virtual o con
+ * /proc/sys/kernel/perf_event_paranoid alto) los demás siguen funcionando.
+ * Solo cuentan eventos en modo usuario. En otros sistemas operativos ningún
+ * contador está disponible.
+ */
+class PerfCounters {
+ public:
+  /**
+   * @brief Eventos que se cuentan.
+   */
+  enum Event {
+    /// Ciclos del procesador.
+    kCycles,
+    /// Instrucciones ejecutadas.
+    kInstructions,
+    /// Saltos con predicción fallida.
+    kBranchMisses,
+    /// Fallos de lectura en la caché L1 de datos.
+    kL1Misses,
+    /// Fallos en la caché de último nivel.
+    kLlcMisses,
+    /// Fallos de página, por ejemplo al tocar memoria recién reservada.
+    kPageFaults,
+    /// Cantidad de eventos.
+    kEventCount
+  };
+
+  /// Valor de cada evento, NaN si el evento no está disponible.
+  using Values = std::array<double, kEventCount>;
+
+ private:
+  /// Descriptor de archivo de cada evento, -1 si no está disponible.
+  std::array<int, kEventCount> descriptors;
+
+ public:
+  /**
+   * @brief Abre los contadores del hilo actual, inicialmente detenidos.
+   */
+  PerfCounters() {
+    this->descriptors.fill(-1);
+#ifdef __linux__
+    for (int event = 0; event < kEventCount; ++event) {
+      perf_event_attr attributes;
+      std::memset(&attributes, 0, sizeof(attributes));
+      attributes.size = sizeof(attributes);
+      PerfCounters::configure(static_cast<Event>(event), attributes);
+      attributes.disabled = 1;
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+      // Contar también los hilos de los algoritmos paralelos.
+      attributes.inherit = 1;
+      attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED
+          | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      this->descriptors[event] = static_cast<int>(syscall(
+          SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+#endif
+  }
+
+  /**
+   * @brief Cierra los contadores.
+   */
+  ~PerfCounters() {
+#ifdef __linux__
+    for (const int descriptor : this->descriptors) {
+      if (descriptor >= 0) { close(descriptor); }
+    }
+#endif
+  }
+
+  PerfCounters(const PerfCounters& other) = delete;
+  PerfCounters(PerfCounters&& other) = delete;
+  PerfCounters& operator=(const PerfCounters& other) = delete;
+  PerfCounters& operator=(PerfCounters&& other) = delete;
+
+  /**
+   * @brief Retorna el nombre de un evento.
+   *
+   * @param event Evento.
+   * @return const char* Nombre del evento.
+   */
+  static const char* name(const Event event) {
+    static constexpr const char* names[kEventCount] = {"cycles",
+        "instructions", "branch_misses", "l1d_misses", "llc_misses",
+        "page_faults"};
+    return names[event];
+  }
+
+  /**
+   * @brief Indica si un evento se puede contar.
+   *
+   * @param event Evento.
+   * @return true Si el contador del evento está abierto.
+   */
+  bool available(const Event event) const {
+    return this->descriptors[event] >= 0;
+  }
+
+  /**
+   * @brief Indica si al menos un evento se puede contar.
+   *
+   * @return true Si algún contador está abierto.
+   */
+  bool available() const {
+    for (int event = 0; event < kEventCount; ++event) {
+      if (this->available(static_cast<Event>(event))) { return true; }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Pone en cero todos los contadores.
+   */
+  void reset() {
+#ifdef __linux__
+    this->control(PERF_EVENT_IOC_RESET);
+#endif
+  }
+
+  /**
+   * @brief Empieza o continúa contando eventos.
+   */
+  void start() {
+#ifdef __linux__
+    this->control(PERF_EVENT_IOC_ENABLE);
+#endif
+  }
+
+  /**
+   * @brief Deja de contar eventos, conservando los valores acumulados.
+   */
+  void stop() {
+#ifdef __linux__
+    this->control(PERF_EVENT_IOC_DISABLE);
+#endif
+  }
+
+  /**
+   * @brief Lee los valores acumulados desde el último reset().
+   *
+   * Si el sistema multiplexó un contador (había más eventos que contadores
+   * físicos), el valor se escala por la fracción del tiempo que estuvo
+   * contando.
+   *
+   * @return Values Valor de cada evento, NaN si no está disponible.
+   */
+  Values read() const {
+    Values values;
+    values.fill(std::numeric_limits<double>::quiet_NaN());
+#ifdef __linux__
+    for (int event = 0; event < kEventCount; ++event) {
+      if (!this->available(static_cast<Event>(event))) { continue; }
+      // Valor, tiempo habilitado y tiempo contando.
+      std::uint64_t data[3] = {0, 0, 0};
+      if (::read(this->descriptors[event], data, sizeof(data))
+          != static_cast<ssize_t>(sizeof(data))) {
+        continue;
+      }
+      values[event] = data[2] == 0 ? static_cast<double>(data[0])
+          : static_cast<double>(data[0]) * static_cast<double>(data[1])
+          / static_cast<double>(data[2]);
+    }
+#endif
+    return values;
+  }
+
+ private:
+#ifdef __linux__
+  /**
+   * @brief Aplica una operación a todos los contadores abiertos.
+   *
+   * @param request Operación de ioctl.
+   */
+  void control(const unsigned long request) {
+    for (const int descriptor : this->descriptors) {
+      if (descriptor >= 0) { ioctl(descriptor, request, 0); }
+    }
+  }
+
+  /**
+   * @brief Llena el tipo y la configuración de perf para un evento.
+   *
+   * @param event Evento.
+   * @param attributes Atributos de perf_event_open a llenar.
+   */
+  static void configure(const Event event, perf_event_attr& attributes) {
+    // Los eventos de caché se codifican como caché | operación << 8 |
+    // resultado << 16.
+    constexpr std::uint64_t read_miss = PERF_COUNT_HW_CACHE_OP_READ << 8
+        | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+    attributes.type = PERF_TYPE_HARDWARE;
+    switch (event) {
+      case kCycles:
+        attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case kInstructions:
+        attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case kBranchMisses:
+        attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+      case kL1Misses:
+        attributes.type = PERF_TYPE_HW_CACHE;
+        attributes.config = PERF_COUNT_HW_CACHE_L1D | read_miss;
+        break;
+      case kLlcMisses:
+        attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+      case kPageFaults:
+        attributes.type = PERF_TYPE_SOFTWARE;
+        attributes.config = PERF_COUNT_SW_PAGE_FAULTS;
+        break;
+      case kEventCount:
+        break;
+    }
+  }
+#endif
+};
@@ -0,0 +1,328 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+/// Indica si se compilan los kernels AVX2.
+#define SIMD_SORT_AVX2 1
+#else
+#define SIMD_SORT_AVX2 0
+#endif
+
+/**
+ * @brief Kernels vectorizados (AVX2) para ordenar arreglos de int: redes de
+ * ordenamiento para bloques de hasta 64 elementos y partición por
+ * compresión.
+ *
+ * La disponibilidad de AVX2 se revisa en tiempo de ejecución con
+ * available(). Los kernels se compilan con el atributo target("avx2"), por
+ * lo que el resto del programa no necesita compilarse con -mavx2, y quien los
+ * llama debe usar una versión escalar si available() es false.
+ */
+class SimdSort {
+ public:
+  /// Cantidad de int en un registro AVX2.
+  static constexpr int lanes = 8;
+  /// Tamaño máximo de un bloque que ordena sortSmall().
+  static constexpr int max_small = 64;
+
+  /**
+   * @brief Indica si el procesador soporta AVX2.
+   *
+   * @return true Si se pueden usar los kernels.
+   * @return false Si se debe usar la versión escalar.
+   */
+  static bool available() {
+#if SIMD_SORT_AVX2
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+  }
+
+#if SIMD_SORT_AVX2
+  /**
+   * @brief Ordena de forma ascendente un bloque de hasta 64 elementos con
+   * redes de ordenamiento, sin saltos que dependan de los datos.
+   *
+   * Rellena el bloque con INT_MAX hasta 1, 2, 4 u 8 registros, ordena cada
+   * registro con una red de Batcher y luego mezcla los registros con redes
+   * bitónicas.
+   *
+   * @param A Arreglo a ordenar.
+   * @param n Tamaño del arreglo, entre 0 y max_small.
+   */
+  __attribute__((target("avx2")))
+  static void sortSmall(int* A, const int n) {
+    alignas(32) int block[SimdSort::max_small];
+    int registers = 1;
+    while (registers * SimdSort::lanes < n) { registers *= 2; }
+    const int padded = registers * SimdSort::lanes;
+    std::copy(A, A + n, block);
+    std::fill(block + n, block + padded, INT_MAX);
+
+    __m256i vectors[SimdSort::max_small / SimdSort::lanes];
+    for (int index = 0; index < registers; ++index) {
+      vectors[index] = SimdSort::sortVector(_mm256_load_si256(
+          reinterpret_cast<const __m256i*>(block + index * SimdSort::lanes)));
+    }
+    // Mezclar grupos de registros ordenados de tamaño 1, 2, 4...
+    for (int width = 1; width < registers; width *= 2) {
+      for (int group = 0; group < registers; group += 2 * width) {
+        SimdSort::mergeRegisters(vectors + group, width);
+      }
+    }
+    for (int index = 0; index < registers; ++index) {
+      _mm256_store_si256(
+          reinterpret_cast<__m256i*>(block + index * SimdSort::lanes),
+          vectors[index]);
+    }
+    std::copy(block, block + n, A);
+  }
+
+  /**
+   * @brief Particiona un arreglo alrededor de un pivote: los menores (o
+   * menores o iguales) quedan al inicio y el resto al final.
+   *
+   * Procesa 8 elementos a la vez: los compara contra el pivote, obtiene una
+   * máscara de bits y con una tabla de permutaciones los reordena para
+   * escribir los menores a la izquierda y los mayores a la derecha, sin
+   * saltos que dependan de los datos. Guarda los primeros y los últimos 8
+   * elementos en registros para tener siempre espacio libre a ambos lados y
+   * trabajar en el mismo arreglo.
+   *
+   * @tparam OrEqual Si es true, los iguales al pivote quedan al inicio; si
+   * es false, al final.
+   * @param A Arreglo a particionar, de al menos 2 * lanes elementos.
+   * @param n Tamaño del arreglo.
+   * @param pivot Pivote.
+   * @return int Cantidad de elementos que quedaron al inicio.
+   */
+  template <bool OrEqual>
+  __attribute__((target("avx2")))
+  static int partition(int* A, const int n, const int pivot) {
+    const __m256i pivots = _mm256_set1_epi32(pivot);
+    // Posiciones de lectura y de escritura en ambos extremos.
+    int read_left = SimdSort::lanes;
+    int read_right = n - SimdSort::lanes;
+    int write_left = 0;
+    int write_right = n;
+
+    const __m256i first = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(A));
+    const __m256i last = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(A + read_right));
+
+    while (read_right - read_left >= SimdSort::lanes) {
+      // Leer del lado con menos espacio libre, así ambos lados tienen al
+      // menos 8 posiciones libres para escribir.
+      __m256i values;
+      if (read_left - write_left <= write_right - read_right) {
+        values = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(A + read_left));
+        read_left += SimdSort::lanes;
+      } else {
+        read_right -= SimdSort::lanes;
+        values = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(A + read_right));
+      }
+      SimdSort::partitionStore<OrEqual>(A, values, pivots, write_left,
+          write_right);
+    }
+
+    // Los menos de 8 elementos restantes se copian antes de escribir, ya
+    // que las escrituras pueden caer sobre ellos.
+    int rest[SimdSort::lanes];
+    const int rest_len = read_right - read_left;
+    std::copy(A + read_left, A + read_right, rest);
+    for (int index = 0; index < rest_len; ++index) {
+      if (OrEqual ? rest[index] <= pivot : rest[index] < pivot) {
+        A[write_left++] = rest[index];
+      } else {
+        A[--write_right] = rest[index];
+      }
+    }
+
+    SimdSort::partitionStore<OrEqual>(A, first, pivots, write_left,
+        write_right);
+    SimdSort::partitionStore<OrEqual>(A, last, pivots, write_left,
+        write_right);
+    return write_left;
+  }
+
+ private:
+  /**
+   * @brief Ordena un registro con una red de ordenamiento.
+   *
+   * Cada capa es un compare-exchange entre pares de carriles.
+   *
+   * @tparam Blend Máscara de los carriles que se quedan con el máximo.
+   * @param values Registro a procesar.
+   * @param partners Carril con el que se compara cada carril.
+   * @return __m256i Registro resultante.
+   */
+  template <int Blend>
+  __attribute__((target("avx2")))
+  static inline __m256i compareExchange(const __m256i values,
+      const __m256i partners) {
+    const __m256i swapped = _mm256_permutevar8x32_epi32(values, partners);
+    return _mm256_blend_epi32(_mm256_min_epi32(values, swapped),
+        _mm256_max_epi32(values, swapped), Blend);
+  }
+
+  /**
+   * @brief Ordena los 8 elementos de un registro con la red de Batcher de
+   * 19 comparadores en 6 capas.
+   *
+   * @param values Registro a ordenar.
+   * @return __m256i Registro ordenado de forma ascendente.
+   */
+  __attribute__((target("avx2")))
+  static inline __m256i sortVector(__m256i values) {
+    values = SimdSort::compareExchange<0xAA>(values,
+        _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6));
+    values = SimdSort::compareExchange<0xCC>(values,
+        _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5));
+    values = SimdSort::compareExchange<0x44>(values,
+        _mm256_setr_epi32(0, 2, 1, 3, 4, 6, 5, 7));
+    values = SimdSort::compareExchange<0xF0>(values,
+        _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3));
+    values = SimdSort::compareExchange<0x30>(values,
+        _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7));
+    values = SimdSort::compareExchange<0x54>(values,
+        _mm256_setr_epi32(0, 2, 1, 4, 3, 6, 5, 7));
+    return values;
+  }
+
+  /**
+   * @brief Ordena un registro cuyos elementos forman una secuencia bitónica,
+   * con comparadores a distancia 4, 2 y 1.
+   *
+   * @param values Registro bitónico.
+   * @return __m256i Registro ordenado de forma ascendente.
+   */
+  __attribute__((target("avx2")))
+  static inline __m256i mergeVector(__m256i values) {
+    values = SimdSort::compareExchange<0xF0>(values,
+        _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3));
+    values = SimdSort::compareExchange<0xCC>(values,
+        _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5));
+    values = SimdSort::compareExchange<0xAA>(values,
+        _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6));
+    return values;
+  }
+
+  /**
+   * @brief Mezcla con una red bitónica dos grupos ordenados de registros
+   * adyacentes, cada uno de width registros.
+   *
+   * Invierte el segundo grupo para que el conjunto sea bitónico, compara
+   * registros a distancia width, width / 2, ..., 1, y termina ordenando cada
+   * registro con mergeVector().
+   *
+   * @param vectors Registros a mezclar, 2 * width en total.
+   * @param width Registros de cada grupo, potencia de 2.
+   */
+  __attribute__((target("avx2")))
+  static void mergeRegisters(__m256i* vectors, const int width) {
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    for (int index = 0; index < width / 2; ++index) {
+      std::swap(vectors[width + index], vectors[2 * width - 1 - index]);
+    }
+    for (int index = width; index < 2 * width; ++index) {
+      vectors[index] = _mm256_permutevar8x32_epi32(vectors[index], reverse);
+    }
+    for (int distance = width; distance > 0; distance /= 2) {
+      for (int index = 0; index < 2 * width; ++index) {
+        if ((index & distance) == 0) {
+          const __m256i low = vectors[index];
+          vectors[index] = _mm256_min_epi32(low, vectors[index + distance]);
+          vectors[index + distance] =
+              _mm256_max_epi32(low, vectors[index + distance]);
+        }
+      }
+    }
+    for (int index = 0; index < 2 * width; ++index) {
+      vectors[index] = SimdSort::mergeVector(vectors[index]);
+    }
+  }
+
+  /**
+   * @brief Construye la tabla de permutaciones de la partición.
+   *
+   * Para cada máscara de 8 bits, donde el bit i indica que el carril i va
+   * al final, guarda los carriles con el bit apagado primero y
+   * luego los que lo tienen encendido, cada grupo en su orden original.
+   *
+   * @return Tabla de 256 permutaciones.
+   */
+  static constexpr std::array<std::array<int32_t, 8>, 256>
+  buildPartitionTable() {
+    std::array<std::array<int32_t, 8>, 256> table{};
+    for (int mask = 0; mask < 256; ++mask) {
+      int position = 0;
+      for (int lane = 0; lane < 8; ++lane) {
+        if ((mask & (1 << lane)) == 0) { table[mask][position++] = lane; }
+      }
+      for (int lane = 0; lane < 8; ++lane) {
+        if ((mask & (1 << lane)) != 0) { table[mask][position++] = lane; }
+      }
+    }
+    return table;
+  }
+
+  /**
+   * @brief Retorna la tabla de permutaciones de la partición, calculada en
+   * tiempo de compilación.
+   *
+   * @return Permutación que agrupa los carriles que van al inicio y luego
+   * los que van al final, para cada máscara de comparación.
+   */
+  static const std::array<std::array<int32_t, 8>, 256>& partitionTable() {
+    alignas(32) static constexpr std::array<std::array<int32_t, 8>, 256>
+        table = SimdSort::buildPartitionTable();
+    return table;
+  }
+
+  /**
+   * @brief Reordena un registro según el pivote y escribe los que van al
+   * inicio en write_left y el resto justo antes de write_right.
+   *
+   * Escribe los 8 carriles en ambos lados, por lo que ambos deben tener al
+   * menos 8 posiciones libres; lo que sobra se sobrescribe después.
+   *
+   * @tparam OrEqual Si es true, los iguales al pivote van al inicio.
+   * @param A Arreglo de salida.
+   * @param values Registro a escribir.
+   * @param pivots Pivote repetido en los 8 carriles.
+   * @param write_left Siguiente posición libre a la izquierda.
+   * @param write_right Posición siguiente a la última libre a la derecha.
+   */
+  template <bool OrEqual>
+  __attribute__((target("avx2")))
+  static inline void partitionStore(int* A, const __m256i values,
+      const __m256i pivots, int& write_left, int& write_right) {
+    // Bit encendido: el carril va al final.
+    const int mask = OrEqual
+        ? _mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpgt_epi32(values, pivots)))
+        : ~_mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpgt_epi32(pivots, values))) & 0xFF;
+    const __m256i permuted = _mm256_permutevar8x32_epi32(values,
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(
+            SimdSort::partitionTable()[mask].data())));
+    const int greater = __builtin_popcount(mask);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(A + write_left), permuted);
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(A + write_right - SimdSort::lanes),
+        permuted);
+    write_left += SimdSort::lanes - greater;
+    write_right -= greater;
+  }
+#endif
+};
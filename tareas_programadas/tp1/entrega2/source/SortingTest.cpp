@@ -1,48 +1,147 @@
 // Copyright 2024 Jose Manuel Mora Z
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
 #include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
 #include <iostream>
 #include <limits>
-#include <random>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#include "Benchmark.hpp"
+#include "ExternalSorter.hpp"
+#include "InputGenerator.hpp"
+#include "MappedFile.hpp"
 #include "Ordenador.hpp"
+#include "StreamingTopK.hpp"
+
+/**
+ * @brief Crea la lista de algoritmos de ordenamiento que puede medir el
+ * benchmark.
+ *
+ * @tparam Sorter Instancia de BasicOrdenador con la política de conteo.
+ * @param sorter Ordenador con los algoritmos.
+ * @param threads Hilos de los algoritmos paralelos, 0 para usar todos los
+ * núcleos.
+ * @return std::vector<SortAlgorithm> Algoritmos disponibles.
+ */
+template <typename Sorter>
+std::vector<SortAlgorithm> sortAlgorithms(const Sorter& sorter, int threads);
 
 /**
- * @brief Genera un arreglo del tamaño especificado con elementos generados
- * aleatoriamente.
+ * @brief Compara el Insertion Sort lineal, binario y con centinela al
+ * ordenar bloques de distintos tamaños, para encontrar a partir de qué
+ * tamaño conviene cada uno.
  *
- * @param arr Arreglo a generar.
- * @param arr_len Tamaño del arreglo.
- * @param min Mínimo para el rango de los números aleatorios.
- * @param max Máximo para el rango de los números aleatorios.
+ * @param out Flujo de salida.
+ * @param sorter Ordenador con los algoritmos.
+ * @param options Opciones de ejecución del benchmark.
  */
-void generateRandomArray(std::vector<int>& arr, std::size_t arr_len,
-    int min, int max);
+void testInsertionCrossover(std::ostream& out, const Ordenador& sorter,
+    const Benchmark::Options& options);
 
 /**
- * @brief Testing para los algoritmos de ordenamiento.
+ * @brief Compara un algoritmo paralelo contra su versión secuencial.
  *
- * Hace una copia del arreglo desordenado para conservar el original.
- * Llama al algoritmo de ordenamiento, tomando el tiempo antes y después de
- * la ejecución para calcular la duración.
- * Reporta los resultados.
+ * Ordena el arreglo con distintas cantidades de hilos (potencias de 2 hasta
+ * la cantidad de núcleos), verifica que el resultado sea idéntico al del
+ * algoritmo secuencial y reporta la aceleración (speedup) obtenida con la
+ * mediana de las repeticiones.
  *
- * @param sort_func Nombre de la subrutina conteniendo el algoritmo.
+ * @param out Flujo de salida.
  * @param sort_name Nombre del algoritmo, usado para impresión.
+ * @param arr Arreglo desordenado original.
+ * @param options Opciones de ejecución del benchmark.
+ * @param sequential Subrutina que ordena un arreglo con un solo hilo.
+ * @param parallel Subrutina que ordena un arreglo con la cantidad de hilos
+ * indicada.
  */
-#define TEST_SORT(sort_func, sort_name) \
-  std::cout << std::endl; \
-  for (std::size_t i = 0; i < 3; ++i) { \
-    std::copy(arr.begin(), arr.end(), arr_cpy.begin()); \
-    auto startTime = std::chrono::high_resolution_clock::now(); \
-    sort_func(arr_cpy.data(), arr_len); \
-    auto endTime = std::chrono::high_resolution_clock::now(); \
-    std::chrono::duration<double, std::milli> duration = endTime - startTime; \
-    std::cout << i + 1 << ". " << sort_name << ":\t" << duration.count() \
-              << " ms" << std::endl; \
-  }
+template <typename Sequential, typename Parallel>
+void testParallelSort(std::ostream& out, const std::string& sort_name,
+    const std::vector<int>& arr, const Benchmark::Options& options,
+    Sequential sequential, Parallel parallel);
+
+/**
+ * @brief Verifica que los algoritmos estables lo sean al ordenar registros
+ * por dos llaves en pasadas sucesivas, y que los paralelos den el mismo
+ * resultado con cualquier cantidad de hilos.
+ *
+ * Cada registro lleva su posición original, por lo que el resultado
+ * esperado es único: el orden por llave primaria, luego secundaria y luego
+ * posición original.
+ *
+ * @param out Flujo de salida.
+ * @param sorter Ordenador con los algoritmos.
+ * @param arr Arreglo desordenado original, del que salen las llaves.
+ */
+void testStability(std::ostream& out, const Ordenador& sorter,
+    const std::vector<int>& arr);
+
+/**
+ * @brief Retorna las cantidades de hilos a probar: potencias de 2 hasta la
+ * cantidad de núcleos, y la cantidad de núcleos.
+ *
+ * @return std::vector<int> Cantidades de hilos.
+ */
+std::vector<int> threadCounts();
+
+/**
+ * @brief Compara las formas de obtener los k menores elementos contra
+ * ordenar el arreglo completo.
+ *
+ * Mide el Introselect del k-ésimo elemento, el ordenamiento parcial con un
+ * montículo acotado y el top-k por bloques de StreamingTopK, verifica que
+ * cada uno obtenga los mismos k elementos que el ordenamiento completo y
+ * reporta la aceleración de cada uno.
+ *
+ * @param out Flujo de salida.
+ * @param sorter Ordenador con los algoritmos.
+ * @param arr Arreglo desordenado original.
+ * @param options Opciones de ejecución del benchmark.
+ */
+void testSelection(std::ostream& out, const Ordenador& sorter,
+    const std::vector<int>& arr, const Benchmark::Options& options);
+
+/**
+ * @brief Ordena un archivo con ExternalSorter, revisa que el resultado esté
+ * ordenado y reporta las duraciones de cada fase.
+ *
+ * @param out Flujo de salida.
+ * @param options Opciones con los archivos y la memoria disponible.
+ * @return true Si el archivo quedó ordenado.
+ */
+bool testExternalSort(std::ostream& out, const Benchmark::Options& options);
+
+/**
+ * @brief Ordena un archivo proyectado en memoria con uno de los algoritmos,
+ * en su lugar o en un segundo archivo proyectado, y reporta la duración y
+ * los fallos de página de cada fase.
+ *
+ * @param out Flujo de salida.
+ * @param options Opciones con los archivos, el algoritmo y la sugerencia de
+ * acceso.
+ * @param algorithms Algoritmos disponibles.
+ * @return true Si el archivo quedó ordenado.
+ */
+bool testMappedSort(std::ostream& out, const Benchmark::Options& options,
+    const std::vector<SortAlgorithm>& algorithms);
+
+/**
+ * @brief Lee los fallos de página acumulados por el proceso.
+ *
+ * @param minor Salida: fallos resueltos sin leer del disco.
+ * @param major Salida: fallos que leyeron del disco.
+ */
+void pageFaults(long& minor, long& major);
 
 /**
  * @brief Start program execution.
@@ -50,57 +149,487 @@ void generateRandomArray(std::vector<int>& arr, std::size_t arr_len,
  * @return Status code to the operating system, 0 means success.
  */
 int main(int argc, char* argv[]) {
-  if (argc == 1) {
-    std::cerr << "Error: No Array Length Provided as Command Line Argument"
-              << std::endl;
+  // Parse the command line options.
+  Benchmark::Options options;
+  if (!Benchmark::parseArguments(argc, argv, options)) {
     return EXIT_FAILURE;
   }
 
-  // Declare Ordenador.
+  // Declare Ordenador, and a copy of it that counts its operations.
   Ordenador Test;
+  BasicOrdenador<OperationCount> CountingTest;
+  std::vector<SortAlgorithm> algorithms = sortAlgorithms(Test,
+      options.threads);
+  const std::vector<SortAlgorithm> counted = sortAlgorithms(CountingTest,
+      options.threads);
+  for (std::size_t index = 0; index < algorithms.size(); ++index) {
+    algorithms[index].counted_sort = counted[index].sort;
+  }
+  if (options.help) {
+    Benchmark::printUsage(std::cout, argv[0], algorithms);
+    return EXIT_SUCCESS;
+  }
 
-  // Obtain array length.
-  const std::size_t arr_len = std::strtoull(argv[1], nullptr, 10);
-  std::cout << std::endl << "Array Length:\t" << arr_len << std::endl;
+  // Sort a memory-mapped file instead of measuring arrays.
+  if (!options.mapped_input.empty()) {
+    return testMappedSort(std::cout, options, algorithms) ? EXIT_SUCCESS
+        : EXIT_FAILURE;
+  }
 
-  // Declare array.
-  std::vector<int> arr(arr_len);
+  // Sort a file that may not fit in memory instead of measuring arrays.
+  if (!options.external_input.empty()) {
+    return testExternalSort(std::cout, options) ? EXIT_SUCCESS
+        : EXIT_FAILURE;
+  }
+
+  // Measure every selected algorithm, size and input distribution.
+  Benchmark benchmark(options);
+  if (!benchmark.run(algorithms)) {
+    return EXIT_FAILURE;
+  }
+  benchmark.print(std::cout);
 
-  // Generate the array numbers.
-  generateRandomArray(arr, arr_len, 0, std::numeric_limits<int>::max());
+  if (options.reports) {
+    // Keep CSV and JSON output machine readable.
+    std::ostream& out = options.format == Benchmark::Format::kTable
+        ? std::cout : std::cerr;
 
-  // Copy to preserve original.
-  std::vector<int> arr_cpy(arr_len);
+    // Linear vs binary vs sentinel Insertion Sort on small blocks.
+    testInsertionCrossover(out, Test, options);
 
-  // Insertion Sort.
-  TEST_SORT(Test.ordenamientoPorInsercion, "Insertion")
+    for (const std::size_t arr_len : options.sizes) {
+      const std::vector<int> arr = InputGenerator::generate(
+          InputGenerator::Distribution::kRandom, arr_len, options.seed);
 
-  // Selection Sort.
-  TEST_SORT(Test.ordenamientoPorSeleccion, "Selection")
+      // Parallel Merge Sort.
+      testParallelSort(out, "Merge", arr, options, [&](int* A, int n) {
+        Test.ordenamientoPorMezcla(A, n);
+      }, [&](int* A, int n, int threads) {
+        Test.ordenamientoPorMezclaParalelo(A, n, threads);
+      });
 
-  // Merge Sort.
-  TEST_SORT(Test.ordenamientoPorMezcla, "Merge")
+      // Parallel Sample Sort against the classic Quick Sort.
+      testParallelSort(out, "Sample", arr, options, [&](int* A, int n) {
+        Test.ordenamientoRapido(A, n);
+      }, [&](int* A, int n, int threads) {
+        Test.ordenamientoPorMuestreoParalelo(A, n, threads);
+      });
 
-  // Heap Sort.
-  TEST_SORT(Test.ordenamientoPorMonticulos, "Heap")
+      // Parallel MSD Radix Sort.
+      testParallelSort(out, "Radix", arr, options, [&](int* A, int n) {
+        Test.ordenamientoPorRadix(A, n);
+      }, [&](int* A, int n, int threads) {
+        Test.ordenamientoPorRadixParalelo(A, n, threads);
+      });
 
-  // Quick Sort.
-  TEST_SORT(Test.ordenamientoRapido, "Quick")
+      // Stable sorts of multi-key records.
+      testStability(out, Test, arr);
 
-  // Radix Sort.
-  TEST_SORT(Test.ordenamientoPorRadix, "Radix")
+      // Top-k selection against a full sort.
+      testSelection(out, Test, arr, options);
+    }
+  }
 
   // Extra empty line just because.
-  std::cout << std::endl;
+  if (options.format == Benchmark::Format::kTable) {
+    std::cout << std::endl;
+  }
+  return EXIT_SUCCESS;
 }
 
-void generateRandomArray(std::vector<int>& arr, std::size_t arr_len,
-    int min, int max) {
-  std::random_device rd;
-  std::mt19937 generator(rd());
-  std::uniform_int_distribution<int> distribution(min, max);
+template <typename Sorter>
+std::vector<SortAlgorithm> sortAlgorithms(const Sorter& sorter,
+    const int threads) {
+  // Adapta los algoritmos que reciben solo el arreglo y su tamaño.
+  auto member = [&sorter](void (Sorter::*sort)(int*, int) const) {
+    return [&sorter, sort](int* A, int n) { (sorter.*sort)(A, n); };
+  };
+
+  // Nombre, subrutina, si es O(n^2) y si solo ordena números no negativos.
+  // El Quick Sort clásico es O(n^2) con entradas ordenadas.
+  return {
+    {"insertion", member(&Sorter::ordenamientoPorInsercion), true},
+    {"insertion-binary", member(&Sorter::ordenamientoPorInsercionBinaria),
+        true},
+    {"insertion-sentinel",
+        member(&Sorter::ordenamientoPorInsercionCentinela), true},
+    {"selection", member(&Sorter::ordenamientoPorSeleccion), true},
+    {"merge", member(&Sorter::ordenamientoPorMezcla)},
+    {"merge-buffer", [&sorter](int* A, int n) {
+      sorter.ordenamientoPorMezclaConBuffer(A, n);
+    }},
+    {"merge-adaptive", member(&Sorter::ordenamientoPorMezclaAdaptativo)},
+    {"merge-parallel", [&sorter, threads](int* A, int n) {
+      sorter.ordenamientoPorMezclaParalelo(A, n, threads);
+    }},
+    {"heap", member(&Sorter::ordenamientoPorMonticulos)},
+    {"heap-floyd", member(&Sorter::ordenamientoPorMonticulosFloyd)},
+    {"heap-4ary", member(&Sorter::ordenamientoPorMonticulosCuaternario)},
+    {"quick", member(&Sorter::ordenamientoRapido), true},
+    {"introsort", member(&Sorter::ordenamientoRapidoIntrospectivo)},
+    {"quick-3way", member(&Sorter::ordenamientoRapidoTresVias)},
+    {"quick-simd", member(&Sorter::ordenamientoRapidoVectorizado)},
+    {"sample-parallel", [&sorter, threads](int* A, int n) {
+      sorter.ordenamientoPorMuestreoParalelo(A, n, threads);
+    }},
+    {"radix", member(&Sorter::ordenamientoPorRadix), false, true},
+    {"radix-bytes", member(&Sorter::ordenamientoPorRadixBytes)},
+    {"radix-parallel", [&sorter, threads](int* A, int n) {
+      sorter.ordenamientoPorRadixParalelo(A, n, threads);
+    }},
+    {"radix-stable-parallel", [&sorter, threads](int* A, int n) {
+      sorter.ordenamientoPorRadixEstableParalelo(A, n, threads);
+    }},
+    // Ordenan indirectamente y luego aplican la permutación al arreglo.
+    {"argsort", [&sorter](int* A, int n) {
+      sorter.aplicarPermutacion(A, A + n,
+          sorter.ordenamientoIndirecto(A, A + n));
+    }},
+    {"argsort-radix", [&sorter](int* A, int n) {
+      sorter.aplicarPermutacion(A, A + n, sorter.ordenamientoIndirecto(A, n));
+    }}};
+}
+
+void testInsertionCrossover(std::ostream& out, const Ordenador& sorter,
+    const Benchmark::Options& options) {
+  // Cantidad total de elementos, ordenados en bloques de cada tamaño.
+  constexpr std::size_t total_len = 1 << 15;
+  const std::vector<int> arr = InputGenerator::generate(
+      InputGenerator::Distribution::kRandom, total_len, options.seed);
+  std::vector<int> arr_cpy(total_len);
+
+  const std::vector<std::pair<std::string, void (Ordenador::*)(int*, int)
+      const>> variants = {
+    {"linear", &Ordenador::ordenamientoPorInsercion},
+    {"binary", &Ordenador::ordenamientoPorInsercionBinaria},
+    {"sentinel", &Ordenador::ordenamientoPorInsercionCentinela}};
+
+  out << std::endl << "Insertion crossover (median ms to sort " << total_len
+      << " elements in blocks)" << std::endl << "block";
+  for (const auto& variant : variants) {
+    out << "\t" << variant.first;
+  }
+  out << "\tfastest" << std::endl;
+
+  for (int block = 4; block <= 4096; block *= 2) {
+    out << block;
+    std::string fastest;
+    double fastest_time = std::numeric_limits<double>::max();
+    for (const auto& [sort_name, sort] : variants) {
+      const double duration = Benchmark::measure(arr, arr_cpy,
+          [&](int* A, int n) {
+            for (int begin = 0; begin < n; begin += block) {
+              (sorter.*sort)(A + begin, std::min(block, n - begin));
+            }
+          }, options.warmup, options.repetitions).median;
+      out << "\t" << duration;
+      if (duration < fastest_time) {
+        fastest_time = duration;
+        fastest = sort_name;
+      }
+    }
+    out << "\t" << fastest << std::endl;
+  }
+}
+
+template <typename Sequential, typename Parallel>
+void testParallelSort(std::ostream& out, const std::string& sort_name,
+    const std::vector<int>& arr, const Benchmark::Options& options,
+    Sequential sequential, Parallel parallel) {
+  std::vector<int> expected(arr.size());
+  std::vector<int> arr_cpy(arr.size());
+
+  const double sequential_time = Benchmark::measure(arr, expected, sequential,
+      options.warmup, options.repetitions).median;
+  out << std::endl << sort_name << " (sequential, n = " << arr.size()
+      << "):\t" << sequential_time << " ms" << std::endl;
+
+  for (const int threads : threadCounts()) {
+    const double parallel_time = Benchmark::measure(arr, arr_cpy,
+        [&](int* A, int n) { parallel(A, n, threads); }, options.warmup,
+        options.repetitions).median;
+    const bool identical = arr_cpy == expected;
+    out << sort_name << " (" << threads << " threads):\t" << parallel_time
+        << " ms\tspeedup: " << sequential_time / parallel_time << "x\t"
+        << (identical ? "identical" : "MISMATCH") << std::endl;
+  }
+}
+
+void testStability(std::ostream& out, const Ordenador& sorter,
+    const std::vector<int>& arr) {
+  // Registro con dos llaves pequeñas, para que haya muchos empates.
+  struct Record {
+    int primary;
+    int secondary;
+    int payload;
+  };
+  std::vector<Record> records(arr.size());
+  for (std::size_t index = 0; index < arr.size(); ++index) {
+    const unsigned int value = static_cast<unsigned int>(arr[index]);
+    records[index] = {static_cast<int>(value / 97 % 16),
+        static_cast<int>(value % 97), static_cast<int>(index)};
+  }
+  std::vector<Record> expected = records;
+  std::sort(expected.begin(), expected.end(),
+      [](const Record& a, const Record& b) {
+        return std::tie(a.primary, a.secondary, a.payload)
+            < std::tie(b.primary, b.secondary, b.payload);
+      });
+
+  auto byPrimary = [](const Record& a, const Record& b) {
+    return a.primary < b.primary;
+  };
+  auto bySecondary = [](const Record& a, const Record& b) {
+    return a.secondary < b.secondary;
+  };
+  auto primaryKey = [](const Record& record) { return record.primary; };
+  auto secondaryKey = [](const Record& record) { return record.secondary; };
+
+  // Nombre, si es paralelo y subrutina que ordena por la llave secundaria y
+  // luego por la primaria con la cantidad de hilos indicada.
+  using Records = std::vector<Record>;
+  const std::vector<std::tuple<std::string, bool,
+      std::function<void(Records&, int)>>> variants = {
+    {"merge", false, [&](Records& data, int) {
+      sorter.ordenamientoPorMezcla(data.begin(), data.end(), bySecondary);
+      sorter.ordenamientoPorMezcla(data.begin(), data.end(), byPrimary);
+    }},
+    {"merge-adaptive", false, [&](Records& data, int) {
+      sorter.ordenamientoPorMezclaAdaptativo(data.begin(), data.end(),
+          bySecondary);
+      sorter.ordenamientoPorMezclaAdaptativo(data.begin(), data.end(),
+          byPrimary);
+    }},
+    {"merge-parallel", true, [&](Records& data, int threads) {
+      sorter.ordenamientoPorMezclaParalelo(data.begin(), data.end(),
+          bySecondary, threads);
+      sorter.ordenamientoPorMezclaParalelo(data.begin(), data.end(),
+          byPrimary, threads);
+    }},
+    {"radix-bytes", false, [&](Records& data, int) {
+      sorter.ordenamientoPorRadixBytes(data.begin(), data.end(),
+          secondaryKey);
+      sorter.ordenamientoPorRadixBytes(data.begin(), data.end(), primaryKey);
+    }},
+    {"radix-stable-parallel", true, [&](Records& data, int threads) {
+      sorter.ordenamientoPorRadixEstableParalelo(data.begin(), data.end(),
+          secondaryKey, threads);
+      sorter.ordenamientoPorRadixEstableParalelo(data.begin(), data.end(),
+          primaryKey, threads);
+    }}};
+
+  out << std::endl << "Stability (n = " << arr.size()
+      << ", sorted by secondary then primary key)" << std::endl;
+  for (const auto& [sort_name, parallel, sort] : variants) {
+    for (const int threads : parallel ? threadCounts()
+        : std::vector<int>{1}) {
+      std::vector<Record> sorted = records;
+      sort(sorted, threads);
+      const bool stable = std::equal(sorted.begin(), sorted.end(),
+          expected.begin(), [](const Record& a, const Record& b) {
+            return a.payload == b.payload;
+          });
+      out << sort_name;
+      if (parallel) {
+        out << " (" << threads << " threads)";
+      }
+      out << ":\t" << (stable ? "stable" : "UNSTABLE") << std::endl;
+    }
+  }
+}
+
+std::vector<int> threadCounts() {
+  // Probar con potencias de 2 hasta la cantidad de núcleos, y con ella.
+  const int cores = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<int> thread_counts;
+  for (int threads = 1; threads < cores; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(cores);
+  return thread_counts;
+}
+
+void testSelection(std::ostream& out, const Ordenador& sorter,
+    const std::vector<int>& arr, const Benchmark::Options& options) {
+  // Cantidad de elementos a seleccionar, y de elementos por bloque.
+  constexpr std::size_t max_k = 1000;
+  constexpr std::size_t chunk_len = 1 << 16;
+  const int k = static_cast<int>(std::min(max_k, arr.size()));
+  std::vector<int> expected(arr.size());
+  std::vector<int> arr_cpy(arr.size());
+  std::vector<int> best;
+
+  const double full_time = Benchmark::measure(arr, expected,
+      [&](int* A, int n) { sorter.ordenamientoRapidoIntrospectivo(A, n); },
+      options.warmup, options.repetitions).median;
+  out << std::endl << "Top-k (k = " << k << ", n = " << arr.size()
+      << ")" << std::endl << "full sort:\t" << full_time << " ms" << std::endl;
+
+  // Cada variante deja sus k menores en best, ordenados.
+  const std::vector<std::pair<std::string, std::function<void(int*, int)>>>
+      variants = {
+    {"nth element", [&](int* A, int n) {
+      sorter.seleccionarEnesimo(A, n, k - 1);
+    }},
+    {"partial sort", [&](int* A, int n) {
+      sorter.ordenamientoParcial(A, n, k);
+    }},
+    {"streaming", [&](int* A, int n) {
+      StreamingTopK<int> top(k);
+      for (int begin = 0; begin < n; begin += chunk_len) {
+        top.push(A + begin, std::min<std::size_t>(chunk_len, n - begin));
+      }
+      best = top.result();
+    }}};
+
+  for (const auto& [variant_name, select] : variants) {
+    const double duration = Benchmark::measure(arr, arr_cpy, select,
+        options.warmup, options.repetitions).median;
+    if (variant_name != "streaming") {
+      best.assign(arr_cpy.begin(), arr_cpy.begin() + k);
+      if (variant_name == "nth element") {
+        std::sort(best.begin(), best.end());
+      }
+    }
+    const bool identical = std::equal(best.begin(), best.end(),
+        expected.begin()) && best.size() == static_cast<std::size_t>(k);
+    out << variant_name << ":\t" << duration << " ms\tspeedup: "
+        << full_time / duration << "x\t"
+        << (identical ? "identical" : "MISMATCH") << std::endl;
+  }
+}
+
+bool testExternalSort(std::ostream& out, const Benchmark::Options& options) {
+  ExternalSorter sorter(options.memory_mb << 20, options.threads,
+      options.temp_dir);
+  if (!sorter.sort(options.external_input, options.external_output)) {
+    return false;
+  }
+
+  const ExternalSorter::Report& report = sorter.getReport();
+  std::size_t count = 0;
+  const bool sorted = ExternalSorter::isSorted(options.external_output,
+      count);
+  out << std::endl << "External sort: " << options.external_input << " -> "
+      << options.external_output << std::endl
+      << "Elements: " << report.elements << "\tMemory: " << options.memory_mb
+      << " MiB\tRuns: " << report.runs << "\tFan-in: " << report.fan_in
+      << "\tMerge passes: " << report.merge_passes << std::endl
+      << "Run generation: " << report.run_ms << " ms\tMerge: "
+      << report.merge_ms << " ms\tTotal: " << report.run_ms + report.merge_ms
+      << " ms" << std::endl
+      << "Check: " << (sorted && count == report.elements ? "ok" : "FAILED")
+      << std::endl << std::endl;
+  return sorted && count == report.elements;
+}
+
+bool testMappedSort(std::ostream& out, const Benchmark::Options& options,
+    const std::vector<SortAlgorithm>& algorithms) {
+  if (options.algorithms.size() > 1) {
+    std::cerr << "Error: --mmap sorts with a single algorithm" << std::endl;
+    return false;
+  }
+  const std::string sort_name = options.algorithms.empty() ? "introsort"
+      : options.algorithms.front();
+  auto algorithm = std::find_if(algorithms.begin(), algorithms.end(),
+      [&](const SortAlgorithm& candidate) {
+        return candidate.name == sort_name;
+      });
+  if (algorithm == algorithms.end()) {
+    std::cerr << "Error: Unknown algorithm " << sort_name << std::endl;
+    return false;
+  }
+
+  // Sin archivo de salida, o si la salida es el mismo archivo de entrada,
+  // se ordena en su lugar: crear la salida truncaría la entrada proyectada.
+  std::error_code error;
+  const bool in_place = options.mapped_output.empty()
+      || std::filesystem::equivalent(options.mapped_input,
+          options.mapped_output, error);
+  MappedFile input;
+  MappedFile output;
+  if (!input.open(options.mapped_input, in_place)) { return false; }
+  if (input.size() % sizeof(int) != 0
+      || input.size() / sizeof(int) > std::numeric_limits<int>::max()) {
+    std::cerr << "Error: " << options.mapped_input << " is not an array of "
+              << "at most " << std::numeric_limits<int>::max() << " int32"
+              << std::endl;
+    return false;
+  }
+  const int length = static_cast<int>(input.size() / sizeof(int));
+  const int* original = static_cast<const int*>(input.data());
+  if (algorithm->non_negative && std::find_if(original, original + length,
+      [](const int key) { return key < 0; }) != original + length) {
+    std::cerr << "Error: " << sort_name << " only sorts non-negative keys"
+              << std::endl;
+    return false;
+  }
+
+  using Clock = std::chrono::high_resolution_clock;
+  long minor_start = 0, major_start = 0, minor_sorted = 0, major_sorted = 0;
+  long minor_end = 0, major_end = 0;
+  pageFaults(minor_start, major_start);
+  const auto start = Clock::now();
+
+  // Copiar al archivo de salida, ambos recorridos de forma secuencial.
+  MappedFile& target = in_place ? input : output;
+  if (!in_place) {
+    if (!output.create(options.mapped_output, input.size())) { return false; }
+    input.advise(MappedFile::Advice::kSequential);
+    output.advise(MappedFile::Advice::kSequential);
+    if (length > 0) {
+      std::memcpy(output.data(), input.data(), input.size());
+    }
+    input.close();
+  }
+  int* keys = static_cast<int*>(target.data());
+
+  const auto copied = Clock::now();
+  long minor_copied = 0, major_copied = 0;
+  pageFaults(minor_copied, major_copied);
+  target.advise(options.advice);
+  if (length > 0) { algorithm->sort(keys, length); }
+  const auto sorted_time = Clock::now();
+  pageFaults(minor_sorted, major_sorted);
+
+  if (!target.sync()) { return false; }
+  const auto end = Clock::now();
+  pageFaults(minor_end, major_end);
+
+  const bool sorted = std::is_sorted(keys, keys + length);
+  const auto milliseconds = [](Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  };
+  std::string advice;
+  for (const auto& [candidate, candidate_name] : MappedFile::all()) {
+    if (candidate == options.advice) { advice = candidate_name; }
+  }
+
+  out << std::endl << "Mapped sort: " << options.mapped_input << " -> "
+      << (in_place ? options.mapped_input : options.mapped_output)
+      << std::endl
+      << "Algorithm: " << sort_name << "\tAdvice: " << advice
+      << "\tElements: " << length << std::endl
+      << "Copy: " << milliseconds(copied - start) << " ms\tSort: "
+      << milliseconds(sorted_time - copied) << " ms\tSync: "
+      << milliseconds(end - sorted_time) << " ms" << std::endl
+      << "Page faults (minor/major):\tcopy: " << minor_copied - minor_start
+      << "/" << major_copied - major_start << "\tsort: "
+      << minor_sorted - minor_copied << "/" << major_sorted - major_copied
+      << "\tsync: " << minor_end - minor_sorted << "/"
+      << major_end - major_sorted << std::endl
+      << "Check: " << (sorted ? "ok" : "FAILED") << std::endl << std::endl;
+  return sorted;
+}
 
-  for (std::size_t index = 0; index < arr_len; ++index) {
-    arr[index] = distribution(generator);
+void pageFaults(long& minor, long& major) {
+  minor = 0;
+  major = 0;
+#ifdef __linux__
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    minor = usage.ru_minflt;
+    major = usage.ru_majflt;
   }
+#endif
 }
@@ -0,0 +1,121 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "Ordenador.hpp"
+
+/**
+ * @brief Selecciona los k mejores elementos de una secuencia que llega por
+ * bloques, sin guardar la secuencia completa.
+ *
+ * Guarda los candidatos en un buffer de 2k elementos. Cuando se llena,
+ * selecciona los k mejores con el Introselect de Ordenador, en O(k), y
+ * descarta el resto. El peor de los k que quedan es un umbral: los
+ * elementos siguientes que no van antes que él se descartan con una sola
+ * comparación, sin copiarlos. Procesar n elementos toma O(n) en promedio y
+ * usa O(k) de memoria.
+ *
+ * @tparam T Tipo de los elementos.
+ * @tparam Compare Comparador, comp(a, b) es true si a va antes que b. Con
+ * std::less selecciona los k menores y con std::greater los k mayores.
+ */
+template <typename T, typename Compare = std::less<>>
+class StreamingTopK {
+ private:
+  /// Ordenador usado para seleccionar y ordenar los candidatos.
+  Ordenador sorter;
+  /// Cantidad de elementos a conservar.
+  std::size_t k = 0;
+  /// Comparador de los elementos.
+  Compare comp;
+  /// Candidatos a estar entre los k mejores.
+  std::vector<T> candidates;
+  /// Peor de los k mejores tras la última compactación.
+  T threshold = T();
+  /// Indica si threshold es válido, es decir, si ya hubo una compactación.
+  bool has_threshold = false;
+
+ public:
+  /**
+   * @brief Construye un selector vacío.
+   *
+   * @param k Cantidad de elementos a conservar.
+   * @param comp Comparador, comp(a, b) es true si a va antes que b.
+   */
+  explicit StreamingTopK(const std::size_t k, Compare comp = Compare())
+    : k(k), comp(comp) {
+    this->candidates.reserve(2 * k);
+  }
+
+  /**
+   * @brief Procesa un bloque de elementos.
+   *
+   * @param values Inicio del bloque.
+   * @param count Cantidad de elementos del bloque.
+   */
+  void push(const T* values, const std::size_t count) {
+    this->push(values, values + count);
+  }
+
+  /**
+   * @brief Procesa un bloque de elementos [first, last).
+   *
+   * @param first Inicio del bloque.
+   * @param last Fin del bloque.
+   */
+  template <typename InputIt>
+  void push(InputIt first, InputIt last) {
+    if (this->k == 0) { return; }
+    for (; first != last; ++first) {
+      if (this->has_threshold && !this->comp(*first, this->threshold)) {
+        continue;
+      }
+      this->candidates.push_back(*first);
+      if (this->candidates.size() == 2 * this->k) {
+        this->compact();
+      }
+    }
+  }
+
+  /**
+   * @brief Retorna los k mejores elementos procesados hasta ahora, o todos
+   * si se procesaron menos de k, ordenados según el comparador.
+   *
+   * @return std::vector<T> Los mejores elementos, ordenados.
+   */
+  std::vector<T> result() const {
+    std::vector<T> best = this->candidates;
+    if (best.size() > this->k) {
+      this->sorter.seleccionarEnesimo(best.begin(), best.end(),
+          static_cast<int>(this->k - 1), this->comp);
+      best.resize(this->k);
+    }
+    if (!best.empty()) {
+      this->sorter.ordenamientoRapidoIntrospectivo(best.begin(), best.end(),
+          this->comp);
+    }
+    return best;
+  }
+
+  /**
+   * @brief Descarta todos los elementos procesados.
+   */
+  void clear() {
+    this->candidates.clear();
+    this->has_threshold = false;
+  }
+
+ private:
+  /**
+   * @brief Conserva solo los k mejores candidatos y actualiza el umbral.
+   */
+  void compact() {
+    this->sorter.seleccionarEnesimo(this->candidates.begin(),
+        this->candidates.end(), static_cast<int>(this->k - 1), this->comp);
+    this->candidates.resize(this->k);
+    this->threshold = this->candidates[this->k - 1];
+    this->has_threshold = true;
+  }
+};
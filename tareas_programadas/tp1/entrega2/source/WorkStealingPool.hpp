@@ -0,0 +1,296 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Pool de hilos con robo de trabajo (work-stealing) para algoritmos
+ * de tipo fork-join.
+ *
+ * Cada trabajador tiene su propia cola doble de tareas. Las tareas nuevas se
+ * agregan y se toman por el final de la cola propia (LIFO), mientras que un
+ * trabajador sin tareas roba del inicio de la cola de otro. El hilo que llama
+ * a run() participa como el trabajador 0, por lo que un pool de n hilos solo
+ * crea n - 1 hilos adicionales.
+ */
+class WorkStealingPool {
+ public:
+  /**
+   * @brief Tarea que puede ser ejecutada por cualquier trabajador del pool.
+   */
+  class Task {
+    friend class WorkStealingPool;
+
+   private:
+    /// Subrutina a ejecutar.
+    std::function<void()> function;
+    /// Indica si la tarea ya terminó de ejecutarse.
+    std::atomic<bool> done{false};
+
+   public:
+    /**
+     * @brief Crea una tarea a partir de una subrutina.
+     *
+     * @param function Subrutina a ejecutar.
+     */
+    explicit Task(std::function<void()> function)
+        : function(std::move(function)) {}
+  };
+
+ private:
+  /**
+   * @brief Cola de tareas de un trabajador.
+   */
+  struct Worker {
+    /// Protege el acceso a la cola.
+    std::mutex mutex;
+    /// Tareas pendientes del trabajador.
+    std::deque<Task*> tasks;
+  };
+
+  /// Colas de los trabajadores, una por hilo.
+  std::vector<Worker> workers;
+  /// Hilos adicionales al hilo que llama a run().
+  std::vector<std::thread> threads;
+  /// Cantidad de tareas en espera en todas las colas.
+  std::atomic<std::size_t> queued{0};
+  /// Indica a los hilos que deben terminar.
+  std::atomic<bool> stop{false};
+  /// Protege la espera de los hilos sin trabajo.
+  std::mutex sleepMutex;
+  /// Despierta a los hilos sin trabajo cuando hay tareas nuevas.
+  std::condition_variable sleepCondition;
+
+  /// Pool al que pertenece el hilo actual.
+  static inline thread_local WorkStealingPool* currentPool = nullptr;
+  /// Índice del trabajador que corresponde al hilo actual.
+  static inline thread_local std::size_t currentIndex = 0;
+
+ public:
+  /**
+   * @brief Crea el pool de hilos.
+   *
+   * @param threadCount Cantidad total de trabajadores, incluyendo al hilo que
+   * llama a run(). Si es 0 se usa la cantidad de núcleos disponibles.
+   */
+  explicit WorkStealingPool(std::size_t threadCount = 0)
+      : workers(WorkStealingPool::resolveThreadCount(threadCount)) {
+    for (std::size_t index = 1; index < this->workers.size(); ++index) {
+      this->threads.emplace_back(&WorkStealingPool::workerLoop, this, index);
+    }
+  }
+
+  /**
+   * @brief Detiene y espera a todos los hilos del pool.
+   */
+  ~WorkStealingPool() {
+    {
+      std::lock_guard<std::mutex> lock(this->sleepMutex);
+      this->stop = true;
+    }
+    this->sleepCondition.notify_all();
+    for (std::thread& thread : this->threads) {
+      thread.join();
+    }
+  }
+
+  WorkStealingPool(const WorkStealingPool& other) = delete;
+  WorkStealingPool(WorkStealingPool&& other) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+  WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+  /**
+   * @brief Retorna la cantidad de trabajadores del pool.
+   *
+   * @return std::size_t Cantidad de trabajadores.
+   */
+  std::size_t size() const { return this->workers.size(); }
+
+  /**
+   * @brief Ejecuta la subrutina raíz de un cómputo fork-join en el hilo
+   * actual, que actúa como el trabajador 0 mientras dure la llamada.
+   *
+   * Solo un hilo externo puede llamar a run() a la vez.
+   *
+   * @param root Subrutina raíz.
+   */
+  template <typename Function>
+  void run(Function&& root) {
+    WorkStealingPool* previousPool = WorkStealingPool::currentPool;
+    const std::size_t previousIndex = WorkStealingPool::currentIndex;
+    WorkStealingPool::currentPool = this;
+    WorkStealingPool::currentIndex = 0;
+    root();
+    WorkStealingPool::currentPool = previousPool;
+    WorkStealingPool::currentIndex = previousIndex;
+  }
+
+  /**
+   * @brief Ejecuta dos subrutinas en paralelo y espera a que ambas terminen.
+   *
+   * La segunda subrutina queda disponible para ser robada por otro trabajador,
+   * mientras que la primera se ejecuta en el hilo actual. Debe llamarse desde
+   * un trabajador del pool (dentro de run()).
+   *
+   * @param first Subrutina ejecutada por el hilo actual.
+   * @param second Subrutina que puede ser robada.
+   */
+  template <typename First, typename Second>
+  void invoke(First&& first, Second&& second) {
+    Task task(std::forward<Second>(second));
+    this->fork(task);
+    first();
+    this->join(task);
+  }
+
+  /**
+   * @brief Ejecuta function(index) para cada índice en [begin, end) en
+   * paralelo, dividiendo el rango en mitades.
+   *
+   * Debe llamarse desde un trabajador del pool (dentro de run()).
+   *
+   * @param begin Primer índice.
+   * @param end Índice siguiente al último.
+   * @param function Subrutina que recibe un índice.
+   */
+  template <typename Function>
+  void parallelFor(const std::size_t begin, const std::size_t end,
+      const Function& function) {
+    if (begin >= end) { return; }
+    if (end - begin == 1) {
+      function(begin);
+      return;
+    }
+    const std::size_t mid = begin + (end - begin) / 2;
+    this->invoke([&] { this->parallelFor(begin, mid, function); },
+        [&] { this->parallelFor(mid, end, function); });
+  }
+
+  /**
+   * @brief Agrega una tarea a la cola del trabajador actual.
+   *
+   * @param task Tarea a agregar. Debe seguir viva hasta llamar a join().
+   */
+  void fork(Task& task) {
+    Worker& worker = this->workers[this->workerIndex()];
+    {
+      std::lock_guard<std::mutex> lock(worker.mutex);
+      worker.tasks.push_back(&task);
+    }
+    ++this->queued;
+    // Tomar el mutex evita que un hilo se duerma justo después de revisar
+    // que no había tareas en espera.
+    { std::lock_guard<std::mutex> lock(this->sleepMutex); }
+    this->sleepCondition.notify_one();
+  }
+
+  /**
+   * @brief Espera a que una tarea termine. Mientras tanto, el hilo actual
+   * ejecuta otras tareas pendientes en lugar de bloquearse.
+   *
+   * @param task Tarea a esperar.
+   */
+  void join(Task& task) {
+    const std::size_t index = this->workerIndex();
+    while (!task.done.load(std::memory_order_acquire)) {
+      Task* other = this->take(index);
+      if (other != nullptr) {
+        WorkStealingPool::execute(other);
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+ private:
+  /**
+   * @brief Calcula la cantidad de trabajadores a usar.
+   *
+   * @param threadCount Cantidad solicitada, 0 para usar todos los núcleos.
+   * @return std::size_t Cantidad de trabajadores, al menos 1.
+   */
+  static std::size_t resolveThreadCount(const std::size_t threadCount) {
+    if (threadCount > 0) { return threadCount; }
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  }
+
+  /**
+   * @brief Retorna el índice del trabajador que corresponde al hilo actual.
+   *
+   * @return std::size_t Índice del trabajador.
+   */
+  std::size_t workerIndex() const {
+    return WorkStealingPool::currentPool == this
+        ? WorkStealingPool::currentIndex : 0;
+  }
+
+  /**
+   * @brief Toma una tarea de la cola propia o, si está vacía, la roba de la
+   * cola de otro trabajador.
+   *
+   * @param index Índice del trabajador actual.
+   * @return Task* Tarea a ejecutar o nullptr si no hay tareas.
+   */
+  Task* take(const std::size_t index) {
+    if (this->queued.load(std::memory_order_relaxed) == 0) { return nullptr; }
+    const std::size_t count = this->workers.size();
+    for (std::size_t offset = 0; offset < count; ++offset) {
+      Worker& worker = this->workers[(index + offset) % count];
+      std::lock_guard<std::mutex> lock(worker.mutex);
+      if (!worker.tasks.empty()) {
+        Task* task = nullptr;
+        if (offset == 0) {
+          // La cola propia se usa como pila: la tarea más reciente.
+          task = worker.tasks.back();
+          worker.tasks.pop_back();
+        } else {
+          // Robar la tarea más antigua, que suele ser la más grande.
+          task = worker.tasks.front();
+          worker.tasks.pop_front();
+        }
+        --this->queued;
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Ejecuta una tarea y la marca como terminada.
+   *
+   * @param task Tarea a ejecutar.
+   */
+  static void execute(Task* task) {
+    task->function();
+    task->done.store(true, std::memory_order_release);
+  }
+
+  /**
+   * @brief Ciclo principal de los hilos adicionales del pool.
+   *
+   * @param index Índice del trabajador asignado al hilo.
+   */
+  void workerLoop(const std::size_t index) {
+    WorkStealingPool::currentPool = this;
+    WorkStealingPool::currentIndex = index;
+    while (!this->stop) {
+      Task* task = this->take(index);
+      if (task != nullptr) {
+        WorkStealingPool::execute(task);
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(this->sleepMutex);
+      this->sleepCondition.wait(lock, [this] {
+        return this->stop || this->queued > 0;
+      });
+    }
+  }
+};
@@ -5,46 +5,197 @@
  */
 
 #pragma once
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
 #include <vector>
 
 #include "DoublyLinkedList.hpp"
+#include "HashPolicies.hpp"
 
 /// @brief Chained hash table
+/// @details When the load factor (values per bucket) exceeds the maximum, the
+/// table doubles its buckets with an incremental rehash: the old buckets are
+/// kept and every insertion or removal moves a few of them to the new ones,
+/// so no single operation pays for moving the whole table. While a rehash is
+/// in progress, searches look in both tables.
 /// @tparam DataType Type of the data stored in the hash table
-template <typename DataType>
+/// @tparam Hash Hash policy that maps a value to its bucket, see
+/// HashPolicies.hpp
+template <typename DataType, typename Hash = DefaultHash<DataType>>
 class ChainedHashTable {
  private:
+  /// @brief Default maximum load factor
+  static constexpr double default_max_load_factor = 1.0;
+  /// @brief Smallest accepted maximum load factor. Smaller ones would make the
+  /// table allocate many empty buckets per value
+  static constexpr double min_max_load_factor = 1.0 / 64;
+  /// @brief Old buckets moved to the new table by each insertion or removal
+  static constexpr size_t rehash_step = 4;
+
+  /// @brief Array of doubly linked lists allocated with calloc
+  /// @details An empty DLList is a single null pointer, so zeroed memory is
+  /// already an array of empty lists. Large arrays get pages that the system
+  /// zeroes the first time they are touched, so allocating the doubled table
+  /// does not construct every bucket inside the insertion that starts the
+  /// rehash
+  class Buckets {
+    static_assert(sizeof(DLList<DataType>) == sizeof(DLListNode<DataType>*),
+        "An empty DLList must be a single null pointer");
+
+   public:
+    /// @brief Constructor of an array without buckets
+    Buckets() = default;
+    /// @brief Constructor
+    /// @param count Number of buckets, all of them empty
+    explicit Buckets(size_t count)
+        : lists(static_cast<DLList<DataType>*>(
+              std::calloc(count, sizeof(DLList<DataType>)))),
+          count(count) {
+      if (count != 0 && this->lists == nullptr) throw std::bad_alloc();
+    }
+    /// @brief Destructor
+    ~Buckets() { this->reset(); }
+
+    // Rule of five
+    /// @brief Deleted copy constructor
+    Buckets(const Buckets& other) = delete;
+    /// @brief Deleted copy assignment operator
+    Buckets& operator=(const Buckets& other) = delete;
+    /// @brief Move constructor
+    Buckets(Buckets&& other) noexcept
+        : lists(std::exchange(other.lists, nullptr)),
+          count(std::exchange(other.count, 0)) {}
+    /// @brief Move assignment operator
+    Buckets& operator=(Buckets&& other) noexcept {
+      if (this != &other) {
+        this->reset();
+        this->lists = std::exchange(other.lists, nullptr);
+        this->count = std::exchange(other.count, 0);
+      }
+      return *this;
+    }
+
+    /// @brief Bucket at an index
+    /// @param index Index of the bucket
+    DLList<DataType>& operator[](size_t index) { return this->lists[index]; }
+    /// @brief Bucket at an index
+    /// @param index Index of the bucket
+    const DLList<DataType>& operator[](size_t index) const {
+      return this->lists[index];
+    }
+
+    /// @brief Getter for the number of buckets
+    /// @return Number of buckets
+    size_t size() const { return this->count; }
+
+    /// @brief Checks if there are no buckets
+    /// @return True if the array has no buckets
+    bool empty() const { return this->count == 0; }
+
+    /// @brief Getter for the first bucket
+    /// @return Pointer to the first bucket
+    const DLList<DataType>* data() const { return this->lists; }
+
+    /// @brief Frees the nodes of every bucket and the array
+    void reset() {
+      for (size_t i = 0; i < this->count; i++) {
+        this->lists[i].clear();
+      }
+      this->release();
+    }
+
+    /// @brief Frees the array without visiting its buckets, which must all
+    /// be empty
+    void release() {
+      std::free(this->lists);
+      this->lists = nullptr;
+      this->count = 0;
+    }
+
+   private:
+    /// @brief Buckets
+    DLList<DataType>* lists = nullptr;
+    /// @brief Number of buckets
+    size_t count = 0;
+  };
+
   /// @brief Size of the hash table
   size_t size;
 
-  /// @brief Vector of doubly linked lists
-  std::vector<DLList<DataType>> table;
+  /// @brief Buckets of the hash table
+  Buckets table;
+
+  /// @brief Buckets of the previous table while a rehash is in progress,
+  /// empty otherwise
+  Buckets old_table;
+
+  /// @brief Next bucket of old_table to move to table
+  size_t rehash_index = 0;
+
+  /// @brief Number of values stored, including repeated ones
+  size_t count = 0;
+
+  /// @brief Load factor that starts a rehash to twice the buckets
+  double max_load_factor;
+
+  /// @brief Hash policy
+  Hash hasher;
 
  public:
   /// @brief Constructor
-  /// @param size Size of the hash table
-  explicit ChainedHashTable(size_t size) : size(size), table(size) {}
+  /// @param size Initial size of the hash table, rounded up to a power of two
+  /// if the hash policy needs it
+  /// @param max_load_factor Load factor that starts a rehash, see
+  /// setMaxLoadFactor
+  explicit ChainedHashTable(size_t size,
+      double max_load_factor = default_max_load_factor)
+      : size(ChainedHashTable::bucketCount(size)), table(this->size),
+        max_load_factor(ChainedHashTable::validLoadFactor(max_load_factor)) {}
   /// @brief Destructor
   ~ChainedHashTable() { this->clear(); }
 
   // Rule of five
   /// @brief Deleted copy constructor
-  ChainedHashTable(const ChainedHashTable<DataType>& other) = delete;
+  ChainedHashTable(const ChainedHashTable<DataType, Hash>& other) = delete;
   /// @brief Deleted copy assignment operator
-  ChainedHashTable<DataType>& operator=(const ChainedHashTable<DataType>& other)
-      = delete;
+  ChainedHashTable<DataType, Hash>& operator=(
+      const ChainedHashTable<DataType, Hash>& other) = delete;
   /// @brief Deleted move constructor
-  ChainedHashTable(ChainedHashTable<DataType>&& other) = delete;
+  ChainedHashTable(ChainedHashTable<DataType, Hash>&& other) = delete;
   /// @brief Deleted move assignment operator
-  ChainedHashTable<DataType>& operator=(ChainedHashTable<DataType>&& other)
-      = delete;
+  ChainedHashTable<DataType, Hash>& operator=(
+      ChainedHashTable<DataType, Hash>&& other) = delete;
 
  private:  // Hash function
-  /// @brief Hash function: k mod m, where k is the value and m is the size of
-  /// the hash table
+  /// @brief Hash function given by the policy, k mod m with ModuloHash
   /// @param value Value to be hashed
-  size_t hash(const DataType& value) const { return value % this->size; }
+  /// @param size Size of the hash table
+  size_t hash(const DataType& value, size_t size) const {
+    return this->hasher(value, size);
+  }
+
+  /// @brief Number of buckets used for a requested size: the same size, or the
+  /// next power of two if the hash policy needs it
+  /// @param size Requested size of the hash table
+  static size_t bucketCount(size_t size) {
+    if constexpr (Hash::power_of_two) {
+      size_t buckets = 1;
+      while (buckets < size) buckets *= 2;
+      return buckets;
+    } else {
+      return size;
+    }
+  }
+
+  /// @brief Maximum load factor actually used for a requested one
+  /// @param max_load_factor Requested maximum load factor
+  static double validLoadFactor(double max_load_factor) {
+    if (!(max_load_factor > 0)) return default_max_load_factor;
+    return std::max(max_load_factor, min_max_load_factor);
+  }
 
  public:
   /// @brief Clears the hash table
@@ -52,42 +203,153 @@ class ChainedHashTable {
     for (size_t i = 0; i < this->size; i++) {
       this->table[i].clear();
     }
+    this->old_table.reset();
+    this->rehash_index = 0;
+    this->count = 0;
   }
 
   /// @brief Inserts a new value in the hash table
   /// @param value Value to be inserted
   void insert(const DataType& value) {
-    size_t index = this->hash(value);
+    this->rehashStep();
+    size_t index = this->hash(value, this->size);
     this->table[index].insert(value);
+    ++this->count;
+    if (this->count > this->max_load_factor * this->size) {
+      this->startRehash(this->size * 2);
+    }
   }
 
   /// @brief Searches for a value in the hash table
   /// @param value Value to be searched
   DLListNode<DataType>* search(const DataType& value) const {
-    size_t index = this->hash(value);
-    return this->table[index].search(value);
+    size_t index = this->hash(value, this->size);
+    DLListNode<DataType>* node = this->table[index].search(value);
+    if (node == nullptr && this->isRehashing()) {
+      index = this->hash(value, this->old_table.size());
+      node = this->old_table[index].search(value);
+    }
+    return node;
   }
 
   /// @brief Removes a value from the hash table
   /// @param value Value to be removed
   void remove(const DataType& value) {
-    size_t index = this->hash(value);
-    this->table[index].remove(value);
+    this->rehashStep();
+    size_t index = this->hash(value, this->size);
+    this->count -= this->table[index].remove(value);
+    if (this->isRehashing()) {
+      index = this->hash(value, this->old_table.size());
+      this->count -= this->old_table[index].remove(value);
+    }
   }
 
   /// @brief Getter for the size of the hash table
   /// @return Size of the hash table
   size_t getSize() const { return this->size; }
 
-  /// @brief Setter for the size of the hash table
-  /// @param size New size of the hash table
-  void setSize(size_t size) { this->size = size; }
+  /// @brief Setter for the size of the hash table. Moves every value to the
+  /// new buckets at once
+  /// @param size New size of the hash table, rounded up to a power of two if
+  /// the hash policy needs it
+  void setSize(size_t size) {
+    if (size == 0) return;
+    this->startRehash(ChainedHashTable::bucketCount(size));
+    this->finishRehash();
+  }
+
+  /// @brief Getter for the number of values in the hash table
+  /// @return Number of values, including repeated ones
+  size_t getCount() const { return this->count; }
+
+  /// @brief Getter for the load factor of the hash table
+  /// @return Values per bucket
+  double getLoadFactor() const {
+    return static_cast<double>(this->count) / this->size;
+  }
+
+  /// @brief Getter for the maximum load factor
+  /// @return Load factor that starts a rehash
+  double getMaxLoadFactor() const { return this->max_load_factor; }
+
+  /// @brief Setter for the maximum load factor
+  /// @param max_load_factor New load factor that starts a rehash. Values that
+  /// are not positive (or NaN) select the default, and small ones are raised
+  /// to min_max_load_factor. Infinity disables growing
+  void setMaxLoadFactor(double max_load_factor) {
+    this->max_load_factor = ChainedHashTable::validLoadFactor(max_load_factor);
+  }
+
+  /// @brief Getter for the length of a chain of the current buckets
+  /// @param index Index of the bucket
+  /// @return Number of values in the bucket
+  size_t getChainLength(size_t index) const {
+    size_t length = 0;
+    DLListNode<DataType>* node = this->table[index].getNil();
+    for (; node != nullptr; node = node->getNext()) ++length;
+    return length;
+  }
+
+  /// @brief Checks if a rehash is in progress
+  /// @return True if some values are still in the old buckets
+  bool isRehashing() const { return !this->old_table.empty(); }
 
   /// @brief Getter for the hash table
-  /// @return Hash table
-  std::vector<DLList<DataType>> getTable() const { return this->table; }
+  /// @return Pointer to the first of getSize() buckets
+  const DLList<DataType>* getTable() const { return this->table.data(); }
+
+  /// @brief Setter for the hash table. Its size becomes the number of lists,
+  /// which must be a power of two if the hash policy needs it
+  /// @param table New hash table, its nodes are moved to this table
+  void setTable(std::vector<DLList<DataType>> table) {
+    this->clear();
+    this->table = Buckets(table.size());
+    this->size = table.size();
+    for (size_t i = 0; i < this->size; i++) {
+      while (table[i].getNil() != nullptr) {
+        table[i].moveFrontTo(this->table[i]);
+        ++this->count;
+      }
+    }
+  }
+
+ private:  // Rehashing
+  /// @brief Starts moving the values to a new table. A rehash in progress is
+  /// finished first
+  /// @param size Size of the new table
+  void startRehash(size_t size) {
+    this->finishRehash();
+    this->old_table = std::move(this->table);
+    this->table = Buckets(size);
+    this->size = size;
+    this->rehash_index = 0;
+  }
 
-  /// @brief Setter for the hash table
-  /// @param table New hash table
-  void setTable(std::vector<DLList<DataType>> table) { this->table = table; }
+  /// @brief Moves the next old buckets to the new table, relinking their nodes
+  /// instead of copying the values. Moves rehash_step buckets, or more with
+  /// small load factors, so the rehash ends before the table fills again
+  void rehashStep() {
+    if (!this->isRehashing()) return;
+    size_t step = std::max(rehash_step,
+        static_cast<size_t>(2 / this->max_load_factor) + 1);
+    size_t end = std::min(this->rehash_index + step, this->old_table.size());
+    for (; this->rehash_index < end; ++this->rehash_index) {
+      DLList<DataType>& bucket = this->old_table[this->rehash_index];
+      while (bucket.getNil() != nullptr) {
+        size_t index = this->hash(bucket.getNil()->getKey(), this->size);
+        bucket.moveFrontTo(this->table[index]);
+      }
+    }
+    // Free the old buckets once they are all empty, without visiting them
+    if (this->rehash_index == this->old_table.size()) {
+      this->old_table.release();
+    }
+  }
+
+  /// @brief Moves every remaining old bucket to the new table
+  void finishRehash() {
+    while (this->isRehashing()) {
+      this->rehashStep();
+    }
+  }
 };
@@ -0,0 +1,141 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include "ChainedHashTable.hpp"
+
+/// @brief Chained hash table that many threads can use at once
+/// @details The values are split in shards by their hash, and each shard is a
+/// ChainedHashTable with its own reader-writer lock (lock striping). Threads
+/// that use different shards never wait for each other, and searches only
+/// take the lock in shared mode, so readers of the same shard do not block
+/// each other either. Each shard grows with its own incremental rehash, so a
+/// writer holds its lock for a bounded time.
+/// @tparam DataType Type of the data stored in the hash table
+/// @tparam Hash Hash policy of the shards, see HashPolicies.hpp
+template <typename DataType, typename Hash = DefaultHash<DataType>>
+class ConcurrentHashTable {
+ public:
+  /// @brief Default number of shards
+  static constexpr size_t default_shards = 64;
+
+ private:
+  /// @brief Part of the hash table. Aligned to a cache line so that the locks
+  /// of different shards do not share one
+  struct alignas(64) Shard {
+    /// @brief Reader-writer lock of the shard
+    mutable std::shared_mutex mutex;
+    /// @brief Values of the shard
+    ChainedHashTable<DataType, Hash> table;
+
+    /// @brief Constructor
+    /// @param size Initial size of the shard's table
+    explicit Shard(size_t size) : table(size) {}
+  };
+
+  /// @brief Number of bits of a shard index
+  int shard_bits = 0;
+
+  /// @brief Shards of the table, a power of two of them
+  std::vector<std::unique_ptr<Shard>> shards;
+
+ public:
+  /// @brief Constructor
+  /// @param size Initial size of the hash table, split among the shards
+  /// @param shards Number of shards, rounded up to a power of two. With one
+  /// shard the whole table has a single lock
+  explicit ConcurrentHashTable(size_t size, size_t shards = default_shards) {
+    while ((size_t(1) << this->shard_bits) < shards) ++this->shard_bits;
+    size_t count = size_t(1) << this->shard_bits;
+    for (size_t i = 0; i < count; i++) {
+      this->shards.push_back(std::make_unique<Shard>(
+          std::max(size / count, size_t(1))));
+    }
+  }
+  /// @brief Destructor
+  ~ConcurrentHashTable() = default;
+
+  // Rule of five
+  /// @brief Deleted copy constructor
+  ConcurrentHashTable(const ConcurrentHashTable<DataType, Hash>& other)
+      = delete;
+  /// @brief Deleted copy assignment operator
+  ConcurrentHashTable<DataType, Hash>& operator=(
+      const ConcurrentHashTable<DataType, Hash>& other) = delete;
+  /// @brief Deleted move constructor
+  ConcurrentHashTable(ConcurrentHashTable<DataType, Hash>&& other) = delete;
+  /// @brief Deleted move assignment operator
+  ConcurrentHashTable<DataType, Hash>& operator=(
+      ConcurrentHashTable<DataType, Hash>&& other) = delete;
+
+ private:  // Shard function
+  /// @brief Shard of a value: the highest bits of std::hash multiplied by an
+  /// odd constant different from the one of MultiplyShiftHash, so that the
+  /// shard does not decide the bucket inside the shard
+  /// @param value Value to be hashed
+  Shard& shardOf(const DataType& value) const {
+    uint64_t hash = static_cast<uint64_t>(std::hash<DataType>()(value))
+        * 0xD6E8FEB86659FD93ull;
+    return *this->shards[this->shard_bits == 0 ? 0
+        : hash >> (64 - this->shard_bits)];
+  }
+
+ public:
+  /// @brief Clears the hash table. Must not run at the same time as other
+  /// operations if they need to see an empty table
+  void clear() {
+    for (auto& shard : this->shards) {
+      std::unique_lock<std::shared_mutex> lock(shard->mutex);
+      shard->table.clear();
+    }
+  }
+
+  /// @brief Inserts a new value in the hash table
+  /// @param value Value to be inserted
+  void insert(const DataType& value) {
+    Shard& shard = this->shardOf(value);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.table.insert(value);
+  }
+
+  /// @brief Searches for a value in the hash table. Returns whether it was
+  /// found instead of its node, which another thread could remove
+  /// @param value Value to be searched
+  /// @return True if the value is in the table
+  bool search(const DataType& value) const {
+    const Shard& shard = this->shardOf(value);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.table.search(value) != nullptr;
+  }
+
+  /// @brief Removes a value from the hash table
+  /// @param value Value to be removed
+  void remove(const DataType& value) {
+    Shard& shard = this->shardOf(value);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.table.remove(value);
+  }
+
+  /// @brief Getter for the number of values in the hash table. Each shard is
+  /// counted at a different moment if other threads are writing
+  /// @return Number of values, including repeated ones
+  size_t getCount() const {
+    size_t count = 0;
+    for (const auto& shard : this->shards) {
+      std::shared_lock<std::shared_mutex> lock(shard->mutex);
+      count += shard->table.getCount();
+    }
+    return count;
+  }
+
+  /// @brief Getter for the number of shards
+  /// @return Number of shards
+  size_t getShards() const { return this->shards.size(); }
+};
@@ -5,6 +5,8 @@
  */
 
 #pragma once
+#include <cstddef>
+
 template <typename DataType>
 class DLList;
 
@@ -119,7 +121,10 @@ class DLList {
 
   /// @brief Removes every node with the given value from the list
   /// @param value Value to be removed
-  void remove(const DataType& value) {
+  /// @return Number of nodes removed
+  size_t remove(const DataType& value) {
+    // Number of nodes removed
+    size_t removed = 0;
     // Node pointers
     DLListNode<DataType>* current = this->nil;
     // Search for the value
@@ -132,10 +137,29 @@ class DLList {
         current = current->getNext();
         // Remove the node
         this->remove(nodeToRemove);
+        ++removed;
       } else
         // Move to the next node
         current = current->getNext();
     }
+    return removed;
+  }
+
+  /// @brief Moves the first node of the list to the start of another list,
+  /// without allocating or freeing memory
+  /// @param other List that receives the node
+  void moveFrontTo(DLList<DataType>& other) {
+    DLListNode<DataType>* node = this->nil;
+    if (node == nullptr) return;
+
+    // Unlink the node from this list
+    this->nil = node->getNext();
+    if (this->nil) this->nil->setPrev(nullptr);
+
+    // Link the node at the front of the other list
+    node->setNext(other.nil);
+    if (other.nil) other.nil->setPrev(node);
+    other.nil = node;
   }
 
  private:  // Remove a specific node
@@ -0,0 +1,137 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+// Hash policies for ChainedHashTable. A policy maps a value to the index of
+// its bucket, given the number of buckets. Policies with power_of_two set to
+// true need a number of buckets that is a power of two, so they can use a bit
+// mask or a shift instead of a division, and the table rounds its size up.
+
+/// @brief Hash function: k mod m, where k is the value and m is the size of
+/// the hash table. Sequential keys fill the buckets evenly, but keys with a
+/// common stride share few buckets
+/// @tparam Key Integral type of the values
+template <typename Key>
+struct ModuloHash {
+  static_assert(std::is_integral_v<Key>, "ModuloHash needs integral keys");
+  /// @brief The table may have any number of buckets
+  static constexpr bool power_of_two = false;
+
+  /// @brief Index of the bucket of a value
+  /// @param value Value to be hashed
+  /// @param size Number of buckets
+  size_t operator()(const Key& value, size_t size) const {
+    return static_cast<size_t>(value) % size;
+  }
+};
+
+/// @brief Hash function: multiply-shift (Fibonacci hashing). Multiplies the
+/// value by 2^64 / phi and keeps the highest log2(m) bits, which depend on all
+/// the bits of the value
+/// @tparam Key Integral type of the values
+template <typename Key>
+struct MultiplyShiftHash {
+  static_assert(std::is_integral_v<Key>,
+      "MultiplyShiftHash needs integral keys");
+  /// @brief The table needs a power of two buckets
+  static constexpr bool power_of_two = true;
+
+  /// @brief Index of the bucket of a value
+  /// @param value Value to be hashed
+  /// @param size Number of buckets, a power of two
+  size_t operator()(const Key& value, size_t size) const {
+    uint64_t hash = static_cast<uint64_t>(value) * 0x9E3779B97F4A7C15ull;
+    int bits = __builtin_ctzll(size);
+    return bits == 0 ? 0 : static_cast<size_t>(hash >> (64 - bits));
+  }
+};
+
+/// @brief Hash function in the style of wyhash: mixes 64-bit words with a
+/// 128-bit multiplication, folding its high half into the low half, and
+/// keeps the lowest log2(m) bits. Hashes integral values and strings
+/// @tparam Key Integral type, or a type convertible to std::string_view
+template <typename Key>
+struct WyHash {
+  /// @brief The table needs a power of two buckets
+  static constexpr bool power_of_two = true;
+
+  /// @brief Index of the bucket of a value
+  /// @param value Value to be hashed
+  /// @param size Number of buckets, a power of two
+  size_t operator()(const Key& value, size_t size) const {
+    uint64_t hash = 0;
+    if constexpr (std::is_integral_v<Key>) {
+      hash = WyHash::mix(WyHash::mix(static_cast<uint64_t>(value)
+          ^ secret[0], secret[1]), secret[2]);
+    } else {
+      std::string_view view(value);
+      hash = WyHash::hashBytes(view.data(), view.size());
+    }
+    return static_cast<size_t>(hash & (size - 1));
+  }
+
+ private:
+  /// @brief Odd constants with mixed bits, from wyhash
+  static constexpr uint64_t secret[3] = {0xa0761d6478bd642full,
+      0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull};
+
+  /// @brief Multiplies two words and folds the 128-bit product into 64 bits
+  /// @param a First word
+  /// @param b Second word
+  static uint64_t mix(uint64_t a, uint64_t b) {
+    __uint128_t product = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(product)
+        ^ static_cast<uint64_t>(product >> 64);
+  }
+
+  /// @brief Reads a word of the given number of bytes, in machine order
+  /// @param data Start of the word
+  template <typename Word>
+  static uint64_t read(const char* data) {
+    Word word;
+    std::memcpy(&word, data, sizeof(Word));
+    return word;
+  }
+
+  /// @brief Hashes a sequence of bytes, 16 bytes per mix. The last bytes are
+  /// read as two words that may overlap
+  /// @param data Start of the bytes
+  /// @param length Number of bytes
+  static uint64_t hashBytes(const char* data, size_t length) {
+    uint64_t seed = secret[0] ^ length;
+    size_t index = 0;
+    for (; index + 16 < length; index += 16) {
+      seed = WyHash::mix(WyHash::read<uint64_t>(data + index) ^ secret[1],
+          WyHash::read<uint64_t>(data + index + 8) ^ seed);
+    }
+
+    size_t rest = length - index;
+    const char* tail = data + index;
+    uint64_t a = 0, b = 0;
+    if (rest > 8) {
+      a = WyHash::read<uint64_t>(tail);
+      b = WyHash::read<uint64_t>(data + length - 8);
+    } else if (rest >= 4) {
+      a = WyHash::read<uint32_t>(tail) << 32
+          | WyHash::read<uint32_t>(tail + rest - 4);
+    } else if (rest > 0) {
+      a = static_cast<uint64_t>(static_cast<unsigned char>(tail[0])) << 16
+          | static_cast<uint64_t>(static_cast<unsigned char>(tail[rest / 2]))
+              << 8
+          | static_cast<unsigned char>(tail[rest - 1]);
+    }
+    return WyHash::mix(secret[2] ^ length,
+        WyHash::mix(a ^ secret[1], b ^ seed));
+  }
+};
+
+/// @brief Default hash policy: multiply-shift for integral values and
+/// WyHash for strings
+/// @tparam Key Type of the values
+template <typename Key>
+using DefaultHash = std::conditional_t<std::is_integral_v<Key>,
+    MultiplyShiftHash<Key>, WyHash<Key>>;
@@ -0,0 +1,250 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/// @brief Open-addressing hash table with Swiss-table style control bytes
+/// @details Values are stored in a flat array of slots, next to an array with
+/// one control byte per slot: empty, deleted, or 7 bits of the value's hash.
+/// A lookup compares the control bytes of a group of 16 slots at once (with
+/// SSE2 when available) and only reads the slots whose byte matches, so it
+/// usually touches one group of control bytes and one slot, instead of
+/// following a list of heap-allocated nodes. Each value is stored once:
+/// inserting a value that is already in the table does nothing.
+/// @tparam DataType Type of the data stored in the hash table
+template <typename DataType>
+class OpenAddressingHashTable {
+ private:
+  /// @brief Number of slots whose control bytes are probed together
+  static constexpr size_t group_size = 16;
+  /// @brief Control byte of a slot that has never been used
+  static constexpr int8_t empty = -128;
+  /// @brief Control byte of a slot whose value was removed
+  static constexpr int8_t deleted = -2;
+  /// @brief Value returned by find when the value is not in the table
+  static constexpr size_t not_found = static_cast<size_t>(-1);
+
+  /// @brief Number of slots, a power of two and a multiple of group_size
+  size_t size;
+  /// @brief Number of values stored
+  size_t count = 0;
+  /// @brief Empty slots that can still be filled before growing the table
+  size_t growth_left = 0;
+  /// @brief Control byte of each slot
+  std::vector<int8_t> control;
+  /// @brief Values, only meaningful where the control byte is a hash
+  std::vector<DataType> slots;
+
+ public:
+  /// @brief Constructor
+  /// @param size Expected number of values, the table grows if it is exceeded
+  explicit OpenAddressingHashTable(size_t size)
+      : size(OpenAddressingHashTable::slotsFor(size)),
+        control(this->size, empty), slots(this->size) {
+    this->growth_left = OpenAddressingHashTable::maxLoad(this->size);
+  }
+  /// @brief Destructor
+  ~OpenAddressingHashTable() = default;
+
+  // Rule of five
+  /// @brief Deleted copy constructor
+  OpenAddressingHashTable(const OpenAddressingHashTable<DataType>& other)
+      = delete;
+  /// @brief Deleted copy assignment operator
+  OpenAddressingHashTable<DataType>& operator=(
+      const OpenAddressingHashTable<DataType>& other) = delete;
+  /// @brief Deleted move constructor
+  OpenAddressingHashTable(OpenAddressingHashTable<DataType>&& other) = delete;
+  /// @brief Deleted move assignment operator
+  OpenAddressingHashTable<DataType>& operator=(
+      OpenAddressingHashTable<DataType>&& other) = delete;
+
+ private:  // Hash function
+  /// @brief Hash function: std::hash mixed with a multiplication by 2^64 / phi,
+  /// so that sequential keys spread over all the groups. The low 7 bits are
+  /// stored in the control byte and the rest choose the first group to probe
+  /// @param value Value to be hashed
+  size_t hash(const DataType& value) const {
+    uint64_t hash = static_cast<uint64_t>(std::hash<DataType>()(value))
+        * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash ^ (hash >> 32));
+  }
+
+  /// @brief Control byte stored for a hash
+  /// @param hash Hash of the value
+  static int8_t controlByte(size_t hash) {
+    return static_cast<int8_t>(hash & 0x7F);
+  }
+
+ public:
+  /// @brief Clears the hash table, keeping its slots
+  void clear() {
+    std::fill(this->control.begin(), this->control.end(), empty);
+    this->count = 0;
+    this->growth_left = OpenAddressingHashTable::maxLoad(this->size);
+  }
+
+  /// @brief Inserts a new value in the hash table, if it is not already there
+  /// @param value Value to be inserted
+  void insert(const DataType& value) {
+    size_t hash = this->hash(value);
+    if (this->find(value, hash) != not_found) return;
+    if (this->growth_left == 0) {
+      // Grow if the table is full of values, or just drop the deleted slots
+      this->rehash(this->count * 2 > OpenAddressingHashTable::maxLoad(
+          this->size) ? this->size * 2 : this->size);
+    }
+    this->place(value, hash);
+  }
+
+  /// @brief Searches for a value in the hash table
+  /// @param value Value to be searched
+  /// @return Pointer to the stored value or nullptr if not found
+  const DataType* search(const DataType& value) const {
+    size_t slot = this->find(value, this->hash(value));
+    return slot == not_found ? nullptr : &this->slots[slot];
+  }
+
+  /// @brief Removes a value from the hash table
+  /// @param value Value to be removed
+  void remove(const DataType& value) {
+    size_t slot = this->find(value, this->hash(value));
+    if (slot == not_found) return;
+    // A group with an empty slot was never full, so no probe went past it
+    // and the slot can be reused as empty. Otherwise leave a tombstone
+    if (this->matchEmpty(slot / group_size) != 0) {
+      this->control[slot] = empty;
+      ++this->growth_left;
+    } else {
+      this->control[slot] = deleted;
+    }
+    --this->count;
+  }
+
+  /// @brief Getter for the size of the hash table
+  /// @return Number of slots of the hash table
+  size_t getSize() const { return this->size; }
+
+  /// @brief Getter for the number of values in the hash table
+  /// @return Number of values stored
+  size_t getCount() const { return this->count; }
+
+ private:
+  /// @brief Maximum number of used slots (values and tombstones), 7/8 of them
+  /// @param size Number of slots
+  static size_t maxLoad(size_t size) { return size - size / 8; }
+
+  /// @brief Smallest valid number of slots that holds the given values
+  /// @param values Number of values
+  static size_t slotsFor(size_t values) {
+    size_t size = group_size;
+    while (OpenAddressingHashTable::maxLoad(size) < values) size *= 2;
+    return size;
+  }
+
+  /// @brief Bit mask of the slots of a group whose control byte is byte
+  /// @param group Index of the group
+  /// @param byte Control byte to look for
+  uint32_t matchByte(size_t group, int8_t byte) const {
+    const int8_t* bytes = this->control.data() + group * group_size;
+#ifdef __SSE2__
+    __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+    return static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(ctrl, _mm_set1_epi8(byte))));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < group_size; ++i) {
+      mask |= static_cast<uint32_t>(bytes[i] == byte) << i;
+    }
+    return mask;
+#endif
+  }
+
+  /// @brief Bit mask of the empty slots of a group
+  /// @param group Index of the group
+  uint32_t matchEmpty(size_t group) const {
+    return this->matchByte(group, empty);
+  }
+
+  /// @brief Bit mask of the empty or deleted slots of a group, the ones
+  /// whose control byte has the sign bit set
+  /// @param group Index of the group
+  uint32_t matchFree(size_t group) const {
+    const int8_t* bytes = this->control.data() + group * group_size;
+#ifdef __SSE2__
+    return static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes))));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < group_size; ++i) {
+      mask |= static_cast<uint32_t>(bytes[i] < 0) << i;
+    }
+    return mask;
+#endif
+  }
+
+  /// @brief Finds the slot of a value. Groups are probed with triangular
+  /// steps (1, 2, 3, ...), which visit every group when their number is a
+  /// power of two, until a group with an empty slot is found
+  /// @param value Value to be searched
+  /// @param hash Hash of the value
+  /// @return Index of the slot or not_found
+  size_t find(const DataType& value, size_t hash) const {
+    size_t groups_mask = this->size / group_size - 1;
+    size_t group = (hash >> 7) & groups_mask;
+    for (size_t step = 1; ; ++step) {
+      uint32_t matches = this->matchByte(group,
+          OpenAddressingHashTable::controlByte(hash));
+      while (matches != 0) {
+        size_t slot = group * group_size + __builtin_ctz(matches);
+        if (this->slots[slot] == value) return slot;
+        matches &= matches - 1;
+      }
+      if (this->matchEmpty(group) != 0) return not_found;
+      group = (group + step) & groups_mask;
+    }
+  }
+
+  /// @brief Stores a value that is not in the table in the first empty or
+  /// deleted slot of its probe sequence. There must be growth left
+  /// @param value Value to be stored
+  /// @param hash Hash of the value
+  void place(const DataType& value, size_t hash) {
+    size_t groups_mask = this->size / group_size - 1;
+    size_t group = (hash >> 7) & groups_mask;
+    uint32_t free = this->matchFree(group);
+    for (size_t step = 1; free == 0; ++step) {
+      group = (group + step) & groups_mask;
+      free = this->matchFree(group);
+    }
+    size_t slot = group * group_size + __builtin_ctz(free);
+    if (this->control[slot] == empty) --this->growth_left;
+    this->control[slot] = OpenAddressingHashTable::controlByte(hash);
+    this->slots[slot] = value;
+    ++this->count;
+  }
+
+  /// @brief Moves every value to a new array of slots, dropping tombstones
+  /// @param size New number of slots
+  void rehash(size_t size) {
+    std::vector<int8_t> old_control(size, empty);
+    std::vector<DataType> old_slots(size);
+    old_control.swap(this->control);
+    old_slots.swap(this->slots);
+    this->size = size;
+    this->count = 0;
+    this->growth_left = OpenAddressingHashTable::maxLoad(size);
+    for (size_t slot = 0; slot < old_control.size(); ++slot) {
+      if (old_control[slot] >= 0) {
+        this->place(old_slots[slot], this->hash(old_slots[slot]));
+      }
+    }
+  }
+};
@@ -0,0 +1,91 @@
+// Copyright 2024 Jose Manuel Mora Z
+#pragma once
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentHashTable.hpp"
+#include "TestConstants.hpp"
+
+/// @brief Number of operations of each throughput measure, split among the
+/// threads
+constexpr std::size_t concurrent_ops = 1000000;
+
+/// @brief Measure the throughput of a Concurrent Hash Table with a mix of
+/// searches, insertions and removals of random values
+/// @param cht Concurrent Hash Table to test
+/// @param threads Number of threads
+/// @param read_percent Percentage of searches, the rest are half insertions
+/// and half removals, so the number of values stays about the same
+/// @return Throughput in millions of operations per second
+double testThroughput(ConcurrentHashTable<int>& cht, std::size_t threads,
+    unsigned int read_percent) {
+  std::vector<std::thread> workers;
+  startTimer()
+  for (std::size_t thread = 0; thread < threads; ++thread) {
+    workers.emplace_back([&cht, threads, thread, read_percent] {
+      // Each thread has its own generator, seeded by its number
+      std::mt19937 generator(thread + 1);
+      std::uniform_int_distribution<int> values(min, max);
+      std::uniform_int_distribution<unsigned int> percent(0, 99);
+      for (std::size_t op = thread; op < concurrent_ops; op += threads) {
+        int value = values(generator);
+        unsigned int kind = percent(generator);
+        if (kind < read_percent) {
+          cht.search(value);
+        } else if ((kind - read_percent) % 2 == 0) {
+          cht.insert(value);
+        } else {
+          cht.remove(value);
+        }
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  endTimer()
+  std::chrono::duration<double, std::micro> duration = endTime - startTime;
+  return concurrent_ops / duration.count();
+}
+
+/// @brief Test the Concurrent Hash Table with a growing number of threads
+/// and several ratios of searches to writes, with a single lock and with lock
+/// striping, starting from the same random values each time
+/// @param insertArr Array of values to fill the table with
+void testCCHT(std::array<int, insert_len>& insertArr) {
+  // Percentages of searches to test
+  const std::array<unsigned int, 3> read_percents = {100, 90, 50};
+  // Powers of 2 up to twice the number of cores, and at least up to 8
+  std::vector<std::size_t> thread_counts;
+  std::size_t max_threads = std::max(8u,
+      2 * std::thread::hardware_concurrency());
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+
+  for (std::size_t shards : {std::size_t(1),
+      ConcurrentHashTable<int>::default_shards}) {
+    std::cout << "\t" << shards << (shards == 1 ? " shard" : " shards")
+              << " (million operations per second):" << std::endl;
+    for (const auto& read_percent : read_percents) {
+      std::cout << "\t\tSearches " << read_percent << "%:";
+      for (const auto& threads : thread_counts) {
+        ConcurrentHashTable<int>* cht =
+            new ConcurrentHashTable<int>(insert_len, shards);
+        for (const auto& value : insertArr)
+          cht->insert(value);
+        std::cout << "\t" << threads << "T: " << std::fixed
+                  << std::setprecision(2)
+                  << testThroughput(*cht, threads, read_percent);
+        std::cout.unsetf(std::ios::floatfield);
+        delete cht;
+      }
+      std::cout << std::endl;
+    }
+  }
+}
@@ -1,10 +1,16 @@
 // Copyright 2024 Jose Manuel Mora Z
 #pragma once
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <iomanip>
 #include <iostream>
 #include <fstream>
+#include <string>
+#include <vector>
 
 #include "ChainedHashTable.hpp"
+#include "OpenAddressingHashTable.hpp"
 #include "TestConstants.hpp"
 
 /// @brief Test the insertion of values in the Chained Hash Table
@@ -26,13 +32,15 @@ void testInsert(ChainedHashTable<int>& cht,
 /// @param searchArr Array of values to search
 void testSearch(ChainedHashTable<int>& cht,
     std::array<int, search_len>& searchArr) {
+  // Count the hits and print them, so the searches are not optimized away
+  std::size_t found = 0;
   startTimer()
   for (const auto& value : searchArr) {
-    cht.search(value);
+    found += cht.search(value) != nullptr;
   }
   endTimer()
   std::cout << "\t\tSearch: \t" << getDuration(startTime, endTime)
-                << std::endl;
+                << "\t(" << found << " found)" << std::endl;
 }
 
 /// @brief Test the removal of values in the Chained Hash Table
@@ -80,3 +88,179 @@ void testCHT(bool random, std::array<int, insert_len>& insertArr,
   // Free the memory
   delete cht;
 }
+
+/// @brief Test the Chained Hash Table growing from a small number of buckets,
+/// reporting the total and the slowest insertion
+/// @param random True if the data should be inserted randomly
+/// @param insertArr Array of values to insert
+/// @param insertArrSorted Array of sorted values to insert
+void testGrowth(bool random, std::array<int, insert_len>& insertArr,
+    std::array<int, insert_len>& insertArrSorted) {
+  // Initial number of buckets, the table rehashes as it grows
+  constexpr std::size_t initial_size = 1024;
+
+  for (std::size_t i = 0; i < runs; ++i) {
+    std::cout << "\tRun " << i + 1 << ":" << std::endl;
+    ChainedHashTable<int>* cht = new ChainedHashTable<int>(initial_size);
+    auto worst = std::chrono::high_resolution_clock::duration::zero();
+    startTimer()
+    for (const auto& value : random ? insertArr : insertArrSorted) {
+      auto before = std::chrono::high_resolution_clock::now();
+      cht->insert(value);
+      worst = std::max(worst, std::chrono::high_resolution_clock::now()
+          - before);
+    }
+    endTimer()
+    std::cout << "\t\tInsertion: \t" << getDuration(startTime, endTime)
+              << std::endl << "\t\tWorst insertion: \t"
+              << getDuration(startTime, startTime + worst) << std::endl
+              << "\t\tFinal size: \t" << cht->getSize() << std::endl;
+    delete cht;
+  }
+}
+
+/// @brief Width of the first column of the chain length table
+constexpr int chain_name_width = 25;
+
+/// @brief Print the distribution of chain lengths of a Chained Hash Table
+/// with the given hash policy, after inserting the values without rehashing
+/// @tparam Hash Hash policy of the table
+/// @param name Name of the policy and the values, used for printing
+/// @param values Values to insert
+template <typename Hash, typename Values>
+void testChainLengths(const std::string& name, const Values& values) {
+  // Longest chain length counted on its own, longer chains are added to it
+  constexpr std::size_t max_length = 8;
+  ChainedHashTable<int, Hash>* cht =
+      new ChainedHashTable<int, Hash>(insert_len);
+
+  startTimer()
+  for (const auto& value : values)
+    cht->insert(value);
+  endTimer()
+
+  std::array<std::size_t, max_length + 1> buckets{};
+  std::size_t longest = 0;
+  for (std::size_t index = 0; index < cht->getSize(); ++index) {
+    std::size_t length = cht->getChainLength(index);
+    ++buckets[std::min(length, max_length)];
+    longest = std::max(longest, length);
+  }
+
+  std::cout << "\t" << std::left << std::setw(chain_name_width) << name + ":";
+  for (const auto& count : buckets) {
+    std::cout << std::fixed << std::setprecision(1)
+              << 100.0 * count / cht->getSize() << "%\t";
+  }
+  std::cout.unsetf(std::ios::floatfield);
+  std::cout << longest << "\t" << getDuration(startTime, endTime)
+            << std::endl;
+  delete cht;
+}
+
+/// @brief Compare the chain lengths of the hash policies with sorted, strided
+/// and random values. Each row has the percentage of buckets with 0 to 7
+/// values and with 8 or more, the longest chain and the insertion time
+/// @param insertArr Array of random values
+/// @param insertArrSorted Array of sorted values
+void testHashPolicies(std::array<int, insert_len>& insertArr,
+    std::array<int, insert_len>& insertArrSorted) {
+  // Stride of the strided values, a power of two like aligned addresses
+  constexpr int stride = 1024;
+  std::vector<int> insertArrStrided(insert_len);
+  for (std::size_t index = 0; index < insert_len; ++index) {
+    insertArrStrided[index] = static_cast<int>(index) * stride;
+  }
+
+  std::cout << "\t" << std::left << std::setw(chain_name_width) << "chains:"
+            << "0\t1\t2\t3\t4\t5\t6\t7\t8+\tmax\tinsertion" << std::endl;
+  testChainLengths<ModuloHash<int>>("modulo, sorted", insertArrSorted);
+  testChainLengths<ModuloHash<int>>("modulo, strided", insertArrStrided);
+  testChainLengths<ModuloHash<int>>("modulo, random", insertArr);
+  testChainLengths<MultiplyShiftHash<int>>("multiply-shift, sorted",
+      insertArrSorted);
+  testChainLengths<MultiplyShiftHash<int>>("multiply-shift, strided",
+      insertArrStrided);
+  testChainLengths<MultiplyShiftHash<int>>("multiply-shift, random",
+      insertArr);
+  testChainLengths<WyHash<int>>("wyhash, sorted", insertArrSorted);
+  testChainLengths<WyHash<int>>("wyhash, strided", insertArrStrided);
+  testChainLengths<WyHash<int>>("wyhash, random", insertArr);
+}
+
+/// @brief Test the insertion of values in the Open Addressing Hash Table
+/// @param oaht Open Addressing Hash Table to test
+/// @param insertArr Array of values to insert
+void testInsert(OpenAddressingHashTable<int>& oaht,
+    std::array<int, insert_len>& insertArr) {
+  startTimer()
+  for (const auto& value : insertArr)
+    oaht.insert(value);
+  endTimer()
+  std::cout << "\t\tInsertion: \t" << getDuration(startTime, endTime)
+                << std::endl;
+}
+
+/// @brief Test the search of values in the Open Addressing Hash Table
+/// @param oaht Open Addressing Hash Table to test
+/// @param searchArr Array of values to search
+void testSearch(OpenAddressingHashTable<int>& oaht,
+    std::array<int, search_len>& searchArr) {
+  // Count the hits and print them, so the searches are not optimized away
+  std::size_t found = 0;
+  startTimer()
+  for (const auto& value : searchArr) {
+    found += oaht.search(value) != nullptr;
+  }
+  endTimer()
+  std::cout << "\t\tSearch: \t" << getDuration(startTime, endTime)
+                << "\t(" << found << " found)" << std::endl;
+}
+
+/// @brief Test the removal of values in the Open Addressing Hash Table
+/// @param oaht Open Addressing Hash Table to test
+/// @param removeArr Array of values to remove
+void testRemove(OpenAddressingHashTable<int>& oaht,
+    std::array<int, remove_len>& removeArr) {
+  startTimer()
+  for (const auto& value : removeArr) {
+    oaht.remove(value);
+  }
+  endTimer()
+  std::cout << "\t\tRemoval: \t" << getDuration(startTime, endTime)
+                << std::endl;
+}
+
+/// @brief Test the Open Addressing Hash Table with the same workload as
+/// testCHT, to compare it with the Chained Hash Table
+/// @param random True if the data should be inserted randomly
+/// @param insertArr Array of values to insert
+/// @param insertArrSorted Array of sorted values to insert
+/// @param searchArr Array of values to search
+/// @param removeArr Array of values to remove
+void testOAHT(bool random, std::array<int, insert_len>& insertArr,
+    std::array<int, insert_len>& insertArrSorted,
+    std::array<int, search_len>& searchArr,
+    std::array<int, remove_len>& removeArr) {
+  // Open Addressing Hash Table
+  OpenAddressingHashTable<int>* oaht =
+      new OpenAddressingHashTable<int>(insert_len);
+
+  for (std::size_t i = 0; i < runs; ++i) {
+    std::cout << "\tRun " << i + 1 << ":" << std::endl;
+    // Insertion
+    testInsert(*oaht, random ? insertArr : insertArrSorted);
+
+    // Search
+    testSearch(*oaht, searchArr);
+
+    // Removal
+    testRemove(*oaht, removeArr);
+
+    // Clear the hash table
+    oaht->clear();
+  }
+
+  // Free the memory
+  delete oaht;
+}
@@ -6,6 +6,7 @@
 #include <random>
 
 #include "TestBST.hpp"
+#include "TestCCHT.hpp"
 #include "TestCHT.hpp"
 #include "TestConstants.hpp"
 #include "TestRBT.hpp"
@@ -79,5 +80,31 @@ int main() {
   std::cout << "\nChained Hash Table: Random" << std::endl;
   testCHT(/* random */ true, insertArr, insertArrSorted, searchArr, removeArr);
 
+  // CHT Hash Policies
+  std::cout << "\nChained Hash Table: Chain Lengths" << std::endl;
+  testHashPolicies(insertArr, insertArrSorted);
+
+  // CHT Growth Sorted
+  std::cout << "\nChained Hash Table: Growth, Sorted" << std::endl;
+  testGrowth(/* random */ false, insertArr, insertArrSorted);
+
+  // CHT Growth Random
+  std::cout << "\nChained Hash Table: Growth, Random" << std::endl;
+  testGrowth(/* random */ true, insertArr, insertArrSorted);
+
+  // OAHT Sorted
+  std::cout << "\nOpen Addressing Hash Table: Sorted" << std::endl;
+  testOAHT(/* random */ false, insertArr, insertArrSorted, searchArr,
+      removeArr);
+
+  // OAHT Random
+  std::cout << "\nOpen Addressing Hash Table: Random" << std::endl;
+  testOAHT(/* random */ true, insertArr, insertArrSorted, searchArr,
+      removeArr);
+
+  // Concurrent CHT
+  std::cout << "\nConcurrent Hash Table: Throughput" << std::endl;
+  testCCHT(insertArr);
+
   return EXIT_SUCCESS;
 }